@@ -9,6 +9,7 @@
 //         * Adding/Removing/Modifying AppItems
 //         * Callback routing
 //         * AppItem parent deduction
+//         * AppItem name registry (constant time lookups by name)
 //     
 //     - This class can eventually just contain all static members & methods
 //     
@@ -18,6 +19,7 @@
 #include <Python.h>
 #include <vector>
 #include <map>
+#include <unordered_map>
 #include <stack>
 #include <string>
 #include <atomic>
@@ -28,6 +30,7 @@
 #include "mvStandardWindow.h"
 #include "mvAppItem.h"
 #include "mvPythonParser.h"
+#include "Core/mvCommandQueue.h"
 
 //-----------------------------------------------------------------------------
 // Typedefs for chrono's ridiculously long names
@@ -79,6 +82,14 @@ namespace Marvel {
             std::string returnname; // optional return function
         };
 
+        struct CachedCallback
+        {
+            PyObject* callable = nullptr; // strong reference
+            PyObject* scope    = nullptr; // dict the name was found in (null for registered callables)
+            PyObject* key      = nullptr; // name as a python string
+            int       holders  = 0;       // items, handlers and queued async calls using a registered callable
+        };
+
     public:
 
         mvApp          (const mvApp& other) = delete;
@@ -104,6 +115,12 @@ namespace Marvel {
         void prerender       ()           override; // pre rendering (every frame)
         void render          (bool& show) override; // actual render loop
         void postrender      ()           override; // post rendering (every frame)
+
+        // power saving, the viewport blocks for up to getEventWait() seconds
+        // (0 means poll) until input arrives or a redraw is requested
+        double getEventWait  ();
+        void   endEventWait  (bool woken);          // woken by an event rather than the timeout
+        void   requestRedraw ();                    // safe from any thread
         
         //-----------------------------------------------------------------------------
         // App Settings
@@ -115,6 +132,7 @@ namespace Marvel {
         void                     setFont           (const std::string& file, float size = 13.0f, const std::string& glyphRange = "");
         void                     setViewport       (mvWindow* viewport) { m_viewport = viewport; }
         void                     setTitle          (const std::string& title) { m_title = title; }
+        void                     setPowerSaving    (bool value) { m_powerSaving = value; }
         
         const std::string&       getActiveWindow   () const { return m_activeWindow; }
         std::vector<mvAppItem*>& getWindows        ()       { return m_windows; }
@@ -123,6 +141,7 @@ namespace Marvel {
         int                      getActualHeight   () const { return m_actualHeight; }
         ImGuiStyle&              getStyle          ()       { return m_newstyle; }
         mvWindow*                getViewport       ()       { return m_viewport; }
+        bool                     getPowerSaving    () const { return m_powerSaving; }
         
         //-----------------------------------------------------------------------------
         // Styles/Themes
@@ -144,11 +163,16 @@ namespace Marvel {
         void     setThreadPoolHighPerformance  ()              { m_threadPoolHighPerformance = true; }
 
         bool     checkIfMainThread             () const;
+        bool     isMainThread                  () const { return std::this_thread::get_id() == m_mainThreadID; }
         double   getThreadPoolTimeout          () const { return m_threadPoolTimeout; }
         unsigned getThreadCount                () const { return m_threads; }
         bool     usingThreadPool               () const { return m_threadPool; }
         bool     usingThreadPoolHighPerformance() const { return m_threadPoolHighPerformance; }
 
+        // queues a command from any thread to run on the main thread (with
+        // the GIL held) at the start of the next frame
+        void     submitCommand                 (mvCommand command) { m_commandQueue.push(std::move(command)); requestRedraw(); }
+
         //-----------------------------------------------------------------------------
         // AppItem Operations
         //-----------------------------------------------------------------------------
@@ -179,6 +203,16 @@ namespace Marvel {
         void runAsyncCallback (std::string name, PyObject* data, std::string returnname);
         void addMTCallback    (const std::string& name, PyObject* data, const std::string& returnname = "");
 
+        // callables passed instead of names are registered under a generated
+        // name, returned as a python string (borrowed). GIL must be held.
+        PyObject* registerCallable  (PyObject* callable);
+        void      invalidateCallback(const std::string& name);
+
+        // registered callables are released when their last holder releases
+        // them, other names are ignored. Takes the GIL.
+        void      retainCallback    (const std::string& name);
+        void      releaseCallback   (const std::string& name);
+
         template<typename T> 
         void dispatchRenderCallback(mvAppItemType itemType, mvAppItem* item)
         {
@@ -200,9 +234,21 @@ namespace Marvel {
 
         mvApp();
 
+        void runCommands        ();
+        void releaseUnheldCallables();
         void routeInputCallbacks();
+        void routeInputBatch    (const std::string& callback);
+
+        // GIL must be held, returns a borrowed reference or null
+        PyObject* resolveCallback   (const std::string& name);
+        void      clearCallbackCache();
         void changeTheme();
         void updateStyle();
+
+        // item registry (item and all of its descendants)
+        void       registerItem  (mvAppItem* item);
+        void       unregisterItem(mvAppItem* item);
+        mvAppItem* findItem      (const std::string& name) const;
         
     private:
 
@@ -238,6 +284,25 @@ namespace Marvel {
         std::queue<std::string>     m_downQueue;
         std::vector<NewRuntimeItem> m_newItemVec;
 
+        // name -> item lookup for everything in the item tree and for
+        // items waiting to be added at runtime. A multimap is used since
+        // some item types (i.e. spacing, text) allow duplicate names.
+        std::unordered_multimap<std::string, mvAppItem*> m_itemRegistry;
+        std::unordered_map<std::string, mvAppItem*>      m_newItemRegistry;
+
+        // callback name -> resolved callable (guarded by the GIL)
+        std::unordered_map<std::string, CachedCallback> m_callbackCache;
+
+        // callables registered since the last frame, dropped at the start of
+        // the next one if nothing retained them (i.e. the command failed)
+        std::vector<std::string> m_unheldCallables;
+        std::atomic_bool         m_unheldPending{ false };
+
+        // power saving
+        std::atomic_bool m_powerSaving{ false };
+        std::atomic_bool m_redraw{ false };   // redraw requested since the last wait
+        int              m_activeFrames = 0;  // frames left to render before waiting again
+
         // timing
         float  m_deltaTime; // time since last frame
         double m_time;      // total time since starting
@@ -245,6 +310,7 @@ namespace Marvel {
         // concurrency
         std::queue<AsyncronousCallback>  m_asyncReturns;
         std::vector<AsyncronousCallback> m_asyncCallbacks;
+        mvCommandQueue                   m_commandQueue;
         mvThreadPool*                    m_tpool = nullptr;
         mutable std::mutex               m_mutex;
         std::thread::id                  m_mainThreadID;
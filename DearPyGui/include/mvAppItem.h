@@ -22,6 +22,8 @@
 
 namespace Marvel {
 
+    struct mvDataValue;
+
     //-----------------------------------------------------------------------------
     // Enums
     //-----------------------------------------------------------------------------
@@ -66,24 +68,27 @@ namespace Marvel {
         virtual void                        draw         ()       = 0;
 
         // virtual methods
-        virtual void                    setPyValue          (PyObject* value) {}
-        virtual void                    updateData          (const std::string& name) {}
-        [[nodiscard]] virtual PyObject* getPyValue          () const { Py_RETURN_NONE; }
-        [[nodiscard]] virtual bool      areDuplicatesAllowed() const { return false; }
+        virtual void                      setPyValue            (PyObject* value) {}
+        virtual bool                      setDataValue          (const mvDataValue& value) { return false; } // false if the python object is needed
+        virtual void                      updateData            (const std::string& name) {}
+        [[nodiscard]] virtual std::string getSecondaryDataSource() const { return ""; } // i.e. listbox list items
+        [[nodiscard]] virtual PyObject*   getPyValue            () const { Py_RETURN_NONE; }
+        [[nodiscard]] virtual bool        areDuplicatesAllowed  () const { return false; }
 
         // color styles for runtime (WORK NEEDED HERE)
         void addColorStyle  (ImGuiCol item, mvColor color);
         void pushColorStyles();
         void popColorStyles ();
 
-        // runtime modifications
-        bool addRuntimeChild       (const std::string& parent, const std::string& before, mvAppItem* item);
-        bool deleteChild           (const std::string& name);
+        // runtime modifications (only operate on direct children,
+        // mvApp resolves the owning container through its registry)
+        bool addRuntimeChild       (mvAppItem* item, mvAppItem* before = nullptr);
+        bool deleteChild           (mvAppItem* item);
         void deleteChildren        ();
-        bool moveChildUp           (const std::string& name);
-        bool moveChildDown         (const std::string& name);
+        bool moveChildUp           (mvAppItem* item);
+        bool moveChildDown         (mvAppItem* item);
         void resetState            ();
-        void updateDataSource      (const std::string& name);
+        void updateDataSource      (const std::string& name); // called by mvDataStorage for subscribed data
         void registerWindowFocusing(); // only useful for imgui window types
 
         // getters
@@ -120,7 +125,7 @@ namespace Marvel {
         void         addChild               (mvAppItem* child);
         inline void  show                   ()                            { m_show = true; }
         inline void  hide                   ()                            { m_show = false; }
-        inline void  setCallback            (const std::string& callback) { m_callback = callback; }
+        void         setCallback            (const std::string& callback);
         inline void  setPopup               (const std::string& popup)    { m_popup = popup; }
         inline void  setTip                 (const std::string& tip)      { m_tip = tip; }
         virtual void setWidth               (int width)                   { m_width = width; }
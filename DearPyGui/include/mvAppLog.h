@@ -3,6 +3,7 @@
 #include <imgui.h>
 #include <string>
 #include <chrono>
+#include <mutex>
 #include "mvCore.h"
 
 namespace Marvel {
@@ -43,6 +44,7 @@ namespace Marvel {
 		static unsigned         s_width;
 		static unsigned         s_height;
 		static ImGuiWindowFlags s_flags;
+		static std::mutex       s_mutex;     // guards Buf and LineOffsets
 
 #if defined (_WIN32)
         static std::chrono::steady_clock::time_point s_start;
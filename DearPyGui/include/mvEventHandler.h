@@ -11,9 +11,23 @@
 //-----------------------------------------------------------------------------
 
 #include <string>
+#include <initializer_list>
 
 namespace Marvel {
 
+    // Callbacks given as python callables are registered by mvApp under a
+    // generated name, which is released once nothing holds it (defined in
+    // mvApp.cpp).
+    void RetainCallback (const std::string& name);
+    void ReleaseCallback(const std::string& name);
+
+    inline void ReplaceCallback(std::string& slot, const std::string& callback)
+    {
+        RetainCallback(callback);
+        ReleaseCallback(slot);
+        slot = callback;
+    }
+
     //-----------------------------------------------------------------------------
     // mvEventHandler
     //-----------------------------------------------------------------------------
@@ -23,6 +37,7 @@ namespace Marvel {
     public:
 
         mvEventHandler() = default;
+        ~mvEventHandler() { clearCallbacks(); }
 
         [[nodiscard]] bool isMouseHandled   () const { return m_handleMouse; }
         [[nodiscard]] bool isKeyboardHandled() const { return m_handleKeyboard; }
@@ -30,17 +45,27 @@ namespace Marvel {
         //-----------------------------------------------------------------------------
         // Callbacks
         //-----------------------------------------------------------------------------
-        void setRenderCallback          (const std::string& callback) { m_renderCallback = callback; }
-        void setResizeCallback          (const std::string& callback) { m_resizeCallback = callback; }
-        void setMouseClickCallback      (const std::string& callback) { m_handleMouse = true; m_mouseClickCallback = callback; }
-        void setMouseDownCallback       (const std::string& callback) { m_handleMouse = true; m_mouseDownCallback = callback; }
-        void setMouseDoubleClickCallback(const std::string& callback) { m_handleMouse = true; m_mouseDoubleClickCallback = callback; }
-        void setMouseReleaseCallback    (const std::string& callback) { m_handleMouse = true; m_mouseReleaseCallback = callback; }
-        void setMouseWheelCallback      (const std::string& callback) { m_handleMouse = true; m_mouseWheelCallback = callback; }
-        void setMouseDragCallback       (const std::string& callback) { m_handleMouse = true; m_mouseDragCallback = callback; }
-        void setKeyDownCallback         (const std::string& callback) { m_handleKeyboard = true; m_keyDownCallback = callback; }
-        void setKeyPressCallback        (const std::string& callback) { m_handleKeyboard = true; m_keyPressCallback = callback; }
-        void setKeyReleaseCallback      (const std::string& callback) { m_handleKeyboard = true; m_keyReleaseCallback = callback; }
+        void setRenderCallback          (const std::string& callback) { ReplaceCallback(m_renderCallback, callback); }
+        void setResizeCallback          (const std::string& callback) { ReplaceCallback(m_resizeCallback, callback); }
+        void setMouseClickCallback      (const std::string& callback) { m_handleMouse = true; ReplaceCallback(m_mouseClickCallback, callback); }
+        void setMouseDownCallback       (const std::string& callback) { m_handleMouse = true; ReplaceCallback(m_mouseDownCallback, callback); }
+        void setMouseDoubleClickCallback(const std::string& callback) { m_handleMouse = true; ReplaceCallback(m_mouseDoubleClickCallback, callback); }
+        void setMouseReleaseCallback    (const std::string& callback) { m_handleMouse = true; ReplaceCallback(m_mouseReleaseCallback, callback); }
+        void setMouseWheelCallback      (const std::string& callback) { m_handleMouse = true; ReplaceCallback(m_mouseWheelCallback, callback); }
+        void setMouseDragCallback       (const std::string& callback) { m_handleMouse = true; ReplaceCallback(m_mouseDragCallback, callback); }
+        void setKeyDownCallback         (const std::string& callback) { m_handleKeyboard = true; ReplaceCallback(m_keyDownCallback, callback); }
+        void setKeyPressCallback        (const std::string& callback) { m_handleKeyboard = true; ReplaceCallback(m_keyPressCallback, callback); }
+        void setKeyReleaseCallback      (const std::string& callback) { m_handleKeyboard = true; ReplaceCallback(m_keyReleaseCallback, callback); }
+        void setInputCallback           (const std::string& callback) { m_handleKeyboard = true; m_handleMouse = true; ReplaceCallback(m_inputCallback, callback); }
+
+        // releases every callback
+        void clearCallbacks()
+        {
+            for (std::string* slot : { &m_renderCallback, &m_mouseDownCallback, &m_mouseClickCallback, &m_mouseReleaseCallback,
+                &m_mouseDoubleClickCallback, &m_mouseWheelCallback, &m_mouseDragCallback, &m_keyDownCallback,
+                &m_keyPressCallback, &m_keyReleaseCallback, &m_resizeCallback, &m_inputCallback })
+                ReplaceCallback(*slot, "");
+        }
 
         [[nodiscard]] const std::string& getRenderCallback          () const { return m_renderCallback; }
         [[nodiscard]] const std::string& getResizeCallback          () const { return m_resizeCallback; }
@@ -53,6 +78,7 @@ namespace Marvel {
         [[nodiscard]] const std::string& getKeyPressCallback        () const { return m_keyPressCallback; }
         [[nodiscard]] const std::string& getKeyReleaseCallback      () const { return m_keyReleaseCallback; }
         [[nodiscard]] const std::string& getMouseWheelCallback      () const { return m_mouseWheelCallback; }
+        [[nodiscard]] const std::string& getInputCallback           () const { return m_inputCallback; }
 
     private:
 
@@ -68,6 +94,7 @@ namespace Marvel {
         std::string m_keyPressCallback;
         std::string m_keyReleaseCallback;
         std::string m_resizeCallback;
+        std::string m_inputCallback; // all input events of a frame in one call
 
         bool m_handleMouse    = false;
         bool m_handleKeyboard = false;
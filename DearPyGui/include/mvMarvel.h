@@ -185,9 +185,49 @@ namespace Marvel {
 			{mvPythonDataType::String, "tag"},
 		}, "Draws a bezier curve on a drawing.", "None", "Drawing") });
 
+		parsers->insert({ "draw_circles", mvPythonParser({
+			{mvPythonDataType::String, "drawing"},
+			{mvPythonDataType::FloatList, "centers"},
+			{mvPythonDataType::FloatList, "radii"},
+			{mvPythonDataType::IntList, "colors"},
+			{mvPythonDataType::Optional},
+			{mvPythonDataType::Integer, "segments"},
+			{mvPythonDataType::Float, "thickness"},
+			{mvPythonDataType::IntList, "fills"},
+			{mvPythonDataType::String, "tag"},
+		}, "Draws many circles on a drawing as one command. Centers are packed x, y pairs, radii are one radius or one per circle "
+			"and colors/fills are one RGBA color or one per circle (packed). Lists or buffers (i.e. numpy arrays) are accepted.", "None", "Drawing") });
+
+		parsers->insert({ "draw_lines", mvPythonParser({
+			{mvPythonDataType::String, "drawing"},
+			{mvPythonDataType::FloatList, "points"},
+			{mvPythonDataType::IntList, "colors"},
+			{mvPythonDataType::Optional},
+			{mvPythonDataType::Float, "thickness"},
+			{mvPythonDataType::String, "tag"},
+		}, "Draws many lines on a drawing as one command. Points are packed x1, y1, x2, y2 per line and colors are one RGBA "
+			"color or one per line (packed). Lists or buffers (i.e. numpy arrays) are accepted.", "None", "Drawing") });
+
+		parsers->insert({ "draw_rectangles", mvPythonParser({
+			{mvPythonDataType::String, "drawing"},
+			{mvPythonDataType::FloatList, "points"},
+			{mvPythonDataType::IntList, "colors"},
+			{mvPythonDataType::Optional},
+			{mvPythonDataType::IntList, "fills"},
+			{mvPythonDataType::Float, "rounding"},
+			{mvPythonDataType::Float, "thickness"},
+			{mvPythonDataType::String, "tag"},
+		}, "Draws many rectangles on a drawing as one command. Points are packed xmin, ymin, xmax, ymax per rectangle and "
+			"colors/fills are one RGBA color or one per rectangle (packed). Lists or buffers (i.e. numpy arrays) are accepted.", "None", "Drawing") });
+
 		parsers->insert({ "clear_drawing", mvPythonParser({
 			{mvPythonDataType::String, "draw"}
 		}, "Clears a drawing.", "None", "Drawing") });
+
+		parsers->insert({ "delete_draw_command", mvPythonParser({
+			{mvPythonDataType::String, "drawing"},
+			{mvPythonDataType::String, "tag"}
+		}, "Deletes the drawing command with the tag.", "None", "Drawing") });
 	}
 
 	static void AddPlotCommands(std::map<std::string, mvPythonParser>* parsers)
@@ -205,7 +245,7 @@ namespace Marvel {
 		{mvPythonDataType::String, "before", "Item to add this item before. (runtime adding)"},
 		{mvPythonDataType::Integer, "width",""},
 		{mvPythonDataType::Integer, "height", ""},
-		{mvPythonDataType::String, "query_callback", "Callback ran when plot is queried. Should be of the form 'def Callback(sender, data)'\n Data is (x_min, x_max, y_min, y_max)."},
+		{mvPythonDataType::Callable, "query_callback", "Callback ran when plot is queried. Should be of the form 'def Callback(sender, data)'\n Data is (x_min, x_max, y_min, y_max)."},
 	}, "Adds a plot widget.", "None", "Plotting") });
 
 		parsers->insert({ "clear_plot", mvPythonParser({
@@ -249,27 +289,43 @@ namespace Marvel {
 		parsers->insert({ "add_line_series", mvPythonParser({
 			{mvPythonDataType::String, "plot"},
 			{mvPythonDataType::String, "name"},
-			{mvPythonDataType::FloatList, "data"},
 			{mvPythonDataType::Optional},
+			{mvPythonDataType::FloatList, "data", "list of [x, y] points (ignored if x and y are used)"},
 			{mvPythonDataType::KeywordOnly},
 			{mvPythonDataType::FloatList, "color"},
 			{mvPythonDataType::FloatList, "fill"},
-			{mvPythonDataType::Float, "weight"}
+			{mvPythonDataType::Float, "weight"},
+			{mvPythonDataType::Object, "x", "x values (list or buffer protocol object i.e. numpy array)"},
+			{mvPythonDataType::Object, "y", "y values (list or buffer protocol object i.e. numpy array)"},
+			{mvPythonDataType::Integer, "capacity", "max number of points kept, oldest points are overwritten (0 for unlimited)"},
 		}, "Adds a line series to a plot.", "None", "Plotting") });
 
 		parsers->insert({ "add_scatter_series", mvPythonParser({
 			{mvPythonDataType::String, "plot"},
 			{mvPythonDataType::String, "name"},
-			{mvPythonDataType::FloatList, "data"},
 			{mvPythonDataType::Optional},
+			{mvPythonDataType::FloatList, "data", "list of [x, y] points (ignored if x and y are used)"},
 			{mvPythonDataType::KeywordOnly},
 			{mvPythonDataType::Integer, "marker"},
 			{mvPythonDataType::Float, "size"},
 			{mvPythonDataType::Float, "weight"},
 			{mvPythonDataType::FloatList, "outline"},
 			{mvPythonDataType::FloatList, "fill"},
+			{mvPythonDataType::Object, "x", "x values (list or buffer protocol object i.e. numpy array)"},
+			{mvPythonDataType::Object, "y", "y values (list or buffer protocol object i.e. numpy array)"},
+			{mvPythonDataType::Integer, "capacity", "max number of points kept, oldest points are overwritten (0 for unlimited)"},
 		}, "Adds a scatter series to a plot.", "None", "Plotting") });
 
+		parsers->insert({ "append_series_data", mvPythonParser({
+			{mvPythonDataType::String, "plot"},
+			{mvPythonDataType::String, "series"},
+			{mvPythonDataType::Optional},
+			{mvPythonDataType::FloatList, "data", "list of [x, y] points (ignored if x and y are used)"},
+			{mvPythonDataType::KeywordOnly},
+			{mvPythonDataType::Object, "x", "x values (list or buffer protocol object i.e. numpy array)"},
+			{mvPythonDataType::Object, "y", "y values (list or buffer protocol object i.e. numpy array)"},
+		}, "Appends points to an existing line or scatter series.", "None", "Plotting") });
+
 		parsers->insert({ "add_text_point", mvPythonParser({
 			{mvPythonDataType::String, "plot"},
 			{mvPythonDataType::String, "name"},
@@ -350,7 +406,7 @@ namespace Marvel {
 	static void AddInputCommands(std::map<std::string, mvPythonParser>* parsers)
 	{
 		parsers->insert({ "set_render_callback", mvPythonParser({
-			{mvPythonDataType::String, "callback"},
+			{mvPythonDataType::Callable, "callback"},
 			{mvPythonDataType::Optional},
 			{mvPythonDataType::String, "handler", "Callback will be run when event occurs while this window/child/popup/menu is active (default is main window)"},
 		}, "Sets the callback to be ran every frame.", "None", "Input Polling") });
@@ -398,59 +454,67 @@ namespace Marvel {
 		}, "Checks if the key is down.", "bool", "Input Polling") });
 
 		parsers->insert({ "set_resize_callback", mvPythonParser({
-			{mvPythonDataType::String, "callback"},
+			{mvPythonDataType::Callable, "callback"},
 			{mvPythonDataType::Optional},
 			{mvPythonDataType::String, "handler", "Callback will be run when event occurs while this window is active (default is main window)"},
 		}, "Sets a callback for a window resize event.", "None", "Input Polling") });
 
 		parsers->insert({ "set_mouse_down_callback", mvPythonParser({
-			{mvPythonDataType::String, "callback"},
+			{mvPythonDataType::Callable, "callback"},
 			{mvPythonDataType::Optional},
 			{mvPythonDataType::String, "handler", "Callback will be run when event occurs while this window is active (default is main window)"},
 		}, "Sets a callback for a mouse down event.", "None", "Input Polling") });
 
 		parsers->insert({ "set_mouse_drag_callback", mvPythonParser({
-			{mvPythonDataType::String, "callback"},
+			{mvPythonDataType::Callable, "callback"},
 			{mvPythonDataType::Float, "threshold"},
 			{mvPythonDataType::Optional},
 			{mvPythonDataType::String, "handler", "Callback will be run when event occurs while this window is active (default is main window)"},
 		}, "Sets a callback for a mouse drag event.", "None", "Input Polling") });
 
 		parsers->insert({ "set_mouse_wheel_callback", mvPythonParser({
-			{mvPythonDataType::String, "callback"},
+			{mvPythonDataType::Callable, "callback"},
 			{mvPythonDataType::Optional},
 			{mvPythonDataType::String, "handler", "Callback will be run when event occurs while this window is active (default is main window)"},
 		}, "Sets a callback for a mouse wheel event.", "None", "Input Polling") });
 
 		parsers->insert({ "set_mouse_double_click_callback", mvPythonParser({
-			{mvPythonDataType::String, "callback"},
+			{mvPythonDataType::Callable, "callback"},
 			{mvPythonDataType::Optional},
 			{mvPythonDataType::String, "handler", "Callback will be run when event occurs while this window is active (default is main window)"},
 		}, "Sets a callback for a mouse double click event.", "None", "Input Polling") });
 
 		parsers->insert({ "set_mouse_click_callback", mvPythonParser({
-			{mvPythonDataType::String, "callback"},
+			{mvPythonDataType::Callable, "callback"},
 			{mvPythonDataType::Optional},
 			{mvPythonDataType::String, "handler", "Callback will be run when event occurs while this window is active (default is main window)"},
 		}, "Sets a callback for a mouse click event.", "None", "Input Polling") });
 
 		parsers->insert({ "set_key_down_callback", mvPythonParser({
-			{mvPythonDataType::String, "callback"},
+			{mvPythonDataType::Callable, "callback"},
 			{mvPythonDataType::Optional},
 			{mvPythonDataType::String, "handler", "Callback will be run when event occurs while this window is active (default is main window)"},
 		}, "Sets a callback for a key down event.", "None", "Input Polling") }),
 
 		parsers->insert({ "set_key_press_callback", mvPythonParser({
-			{mvPythonDataType::String, "callback"},
+			{mvPythonDataType::Callable, "callback"},
 			{mvPythonDataType::Optional},
 			{mvPythonDataType::String, "handler", "Callback will be run when event occurs while this window is active (default is main window)"},
 			}, "Sets a callback for a key press event.", "None", "Input Polling") });
 
 		parsers->insert({ "set_key_release_callback", mvPythonParser({
-			{mvPythonDataType::String, "callback"},
+			{mvPythonDataType::Callable, "callback"},
 			{mvPythonDataType::Optional},
 			{mvPythonDataType::String, "handler", "Callback will be run when event occurs while this window is active (default is main window)"},
 		}, "Sets a callback for a key release event.", "None", "Input Polling") });
+
+		parsers->insert({ "set_input_callback", mvPythonParser({
+			{mvPythonDataType::Callable, "callback"},
+			{mvPythonDataType::Optional},
+			{mvPythonDataType::String, "handler", "Callback will be run when event occurs while this window is active (default is main window)"},
+		}, "Sets a callback receiving all key and mouse events of a frame in a single call. The data is a dict with "
+			"keys_pressed, keys_down, keys_released, mouse_clicked, mouse_double_clicked, mouse_down, mouse_released "
+			"and mouse_wheel. Down events are (index, duration) pairs. Only called on frames with input.", "None", "Input Polling") });
 	}
 
 	static void AddInputWidgets(std::map<std::string, mvPythonParser>* parsers)
@@ -467,7 +531,7 @@ namespace Marvel {
 			{mvPythonDataType::Bool, "hexadecimal"},
 			{mvPythonDataType::Bool, "readonly"},
 			{mvPythonDataType::Bool, "password", "hides text values"},
-			{mvPythonDataType::String, "callback", "Registers a callback"},
+			{mvPythonDataType::Callable, "callback", "Registers a callback"},
 			{mvPythonDataType::String, "tip", "Adds a simple tooltip"},
 			{mvPythonDataType::String, "parent", "Parent to add this item to. (runtime adding)"},
 			{mvPythonDataType::String, "before", "Item to add this item before. (runtime adding)"},
@@ -479,7 +543,7 @@ namespace Marvel {
 			{mvPythonDataType::String, "name"},
 			{mvPythonDataType::KeywordOnly},
 			{mvPythonDataType::Integer, "default_value"},
-			{mvPythonDataType::String, "callback", "Registers a callback"},
+			{mvPythonDataType::Callable, "callback", "Registers a callback"},
 			{mvPythonDataType::String, "tip", "Adds a simple tooltip"},
 			{mvPythonDataType::String, "parent", "Parent to add this item to. (runtime adding)"},
 			{mvPythonDataType::String, "before", "Item to add this item before. (runtime adding)"},
@@ -491,7 +555,7 @@ namespace Marvel {
 			{mvPythonDataType::String, "name"},
 			{mvPythonDataType::KeywordOnly},
 			{mvPythonDataType::IntList, "default_value"},
-			{mvPythonDataType::String, "callback", "Registers a callback"},
+			{mvPythonDataType::Callable, "callback", "Registers a callback"},
 			{mvPythonDataType::String, "tip", "Adds a simple tooltip"},
 			{mvPythonDataType::String, "parent", "Parent to add this item to. (runtime adding)"},
 			{mvPythonDataType::String, "before", "Item to add this item before. (runtime adding)"},
@@ -503,7 +567,7 @@ namespace Marvel {
 			{mvPythonDataType::String, "name"},
 			{mvPythonDataType::KeywordOnly},
 			{mvPythonDataType::IntList, "default_value"},
-			{mvPythonDataType::String, "callback", "Registers a callback"},
+			{mvPythonDataType::Callable, "callback", "Registers a callback"},
 			{mvPythonDataType::String, "tip", "Adds a simple tooltip"},
 			{mvPythonDataType::String, "parent", "Parent to add this item to. (runtime adding)"},
 			{mvPythonDataType::String, "before", "Item to add this item before. (runtime adding)"},
@@ -515,7 +579,7 @@ namespace Marvel {
 			{mvPythonDataType::String, "name"},
 			{mvPythonDataType::KeywordOnly},
 			{mvPythonDataType::IntList, "default_value"},
-			{mvPythonDataType::String, "callback", "Registers a callback"},
+			{mvPythonDataType::Callable, "callback", "Registers a callback"},
 			{mvPythonDataType::String, "tip", "Adds a simple tooltip"},
 			{mvPythonDataType::String, "parent", "Parent to add this item to. (runtime adding)"},
 			{mvPythonDataType::String, "before", "Item to add this item before. (runtime adding)"},
@@ -528,7 +592,7 @@ namespace Marvel {
 			{mvPythonDataType::KeywordOnly},
 			{mvPythonDataType::Float, "default_value"},
 			{mvPythonDataType::String, "format"},
-			{mvPythonDataType::String, "callback", "Registers a callback"},
+			{mvPythonDataType::Callable, "callback", "Registers a callback"},
 			{mvPythonDataType::String, "tip", "Adds a simple tooltip"},
 			{mvPythonDataType::String, "parent", "Parent to add this item to. (runtime adding)"},
 			{mvPythonDataType::String, "before", "Item to add this item before. (runtime adding)"},
@@ -541,7 +605,7 @@ namespace Marvel {
 			{mvPythonDataType::KeywordOnly},
 			{mvPythonDataType::FloatList, "default_value"},
 			{mvPythonDataType::String, "format"},
-			{mvPythonDataType::String, "callback", "Registers a callback"},
+			{mvPythonDataType::Callable, "callback", "Registers a callback"},
 			{mvPythonDataType::String, "tip", "Adds a simple tooltip"},
 			{mvPythonDataType::String, "parent", "Parent to add this item to. (runtime adding)"},
 			{mvPythonDataType::String, "before", "Item to add this item before. (runtime adding)"},
@@ -554,7 +618,7 @@ namespace Marvel {
 			{mvPythonDataType::KeywordOnly},
 			{mvPythonDataType::FloatList, "default_value"},
 			{mvPythonDataType::String, "format"},
-			{mvPythonDataType::String, "callback", "Registers a callback"},
+			{mvPythonDataType::Callable, "callback", "Registers a callback"},
 			{mvPythonDataType::String, "tip", "Adds a simple tooltip"},
 			{mvPythonDataType::String, "parent", "Parent to add this item to. (runtime adding)"},
 			{mvPythonDataType::String, "before", "Item to add this item before. (runtime adding)"},
@@ -567,7 +631,7 @@ namespace Marvel {
 			{mvPythonDataType::KeywordOnly},
 			{mvPythonDataType::FloatList, "default_value"},
 			{mvPythonDataType::String, "format"},
-			{mvPythonDataType::String, "callback", "Registers a callback"},
+			{mvPythonDataType::Callable, "callback", "Registers a callback"},
 			{mvPythonDataType::String, "tip", "Adds a simple tooltip"},
 			{mvPythonDataType::String, "parent", "Parent to add this item to. (runtime adding)"},
 			{mvPythonDataType::String, "before", "Item to add this item before. (runtime adding)"},
@@ -586,7 +650,7 @@ namespace Marvel {
 			{mvPythonDataType::Float, "max_value"},
 			{mvPythonDataType::String, "format"},
 			{mvPythonDataType::Bool, "vertical", "sets orientation to vertical"},
-			{mvPythonDataType::String, "callback", "Registers a callback"},
+			{mvPythonDataType::Callable, "callback", "Registers a callback"},
 			{mvPythonDataType::String, "tip", "Adds a simple tooltip"},
 			{mvPythonDataType::String, "parent", "Parent to add this item to. (runtime adding)"},
 			{mvPythonDataType::String, "before", "Item to add this item before. (runtime adding)"},
@@ -602,7 +666,7 @@ namespace Marvel {
 			{mvPythonDataType::Float, "min_value"},
 			{mvPythonDataType::Float, "max_value"},
 			{mvPythonDataType::String, "format"},
-			{mvPythonDataType::String, "callback", "Registers a callback"},
+			{mvPythonDataType::Callable, "callback", "Registers a callback"},
 			{mvPythonDataType::String, "tip", "Adds a simple tooltip"},
 			{mvPythonDataType::String, "parent", "Parent to add this item to. (runtime adding)"},
 			{mvPythonDataType::String, "before", "Item to add this item before. (runtime adding)"},
@@ -617,7 +681,7 @@ namespace Marvel {
 			{mvPythonDataType::Float, "min_value"},
 			{mvPythonDataType::Float, "max_value"},
 			{mvPythonDataType::String, "format"},
-			{mvPythonDataType::String, "callback", "Registers a callback"},
+			{mvPythonDataType::Callable, "callback", "Registers a callback"},
 			{mvPythonDataType::String, "tip", "Adds a simple tooltip"},
 			{mvPythonDataType::String, "parent", "Parent to add this item to. (runtime adding)"},
 			{mvPythonDataType::String, "before", "Item to add this item before. (runtime adding)"},
@@ -632,7 +696,7 @@ namespace Marvel {
 			{mvPythonDataType::Float, "min_value"},
 			{mvPythonDataType::Float, "max_value"},
 			{mvPythonDataType::String, "format"},
-			{mvPythonDataType::String, "callback", "Registers a callback"},
+			{mvPythonDataType::Callable, "callback", "Registers a callback"},
 			{mvPythonDataType::String, "tip", "Adds a simple tooltip"},
 			{mvPythonDataType::String, "parent", "Parent to add this item to. (runtime adding)"},
 			{mvPythonDataType::String, "before", "Item to add this item before. (runtime adding)"},
@@ -648,7 +712,7 @@ namespace Marvel {
 			{mvPythonDataType::Integer, "max_value"},
 			{mvPythonDataType::String, "format"},
 			{mvPythonDataType::Bool, "vertical", "sets orientation to vertical"},
-			{mvPythonDataType::String, "callback", "Registers a callback"},
+			{mvPythonDataType::Callable, "callback", "Registers a callback"},
 			{mvPythonDataType::String, "tip", "Adds a simple tooltip"},
 			{mvPythonDataType::String, "parent", "Parent to add this item to. (runtime adding)"},
 			{mvPythonDataType::String, "before", "Item to add this item before. (runtime adding)"},
@@ -664,7 +728,7 @@ namespace Marvel {
 			{mvPythonDataType::Integer, "min_value"},
 			{mvPythonDataType::Integer, "max_value"},
 			{mvPythonDataType::String, "format"},
-			{mvPythonDataType::String, "callback", "Registers a callback"},
+			{mvPythonDataType::Callable, "callback", "Registers a callback"},
 			{mvPythonDataType::String, "tip", "Adds a simple tooltip"},
 			{mvPythonDataType::String, "parent", "Parent to add this item to. (runtime adding)"},
 			{mvPythonDataType::String, "before", "Item to add this item before. (runtime adding)"},
@@ -679,7 +743,7 @@ namespace Marvel {
 			{mvPythonDataType::Integer, "min_value"},
 			{mvPythonDataType::Integer, "max_value"},
 			{mvPythonDataType::String, "format"},
-			{mvPythonDataType::String, "callback", "Registers a callback"},
+			{mvPythonDataType::Callable, "callback", "Registers a callback"},
 			{mvPythonDataType::String, "tip", "Adds a simple tooltip"},
 			{mvPythonDataType::String, "parent", "Parent to add this item to. (runtime adding)"},
 			{mvPythonDataType::String, "before", "Item to add this item before. (runtime adding)"},
@@ -694,7 +758,7 @@ namespace Marvel {
 			{mvPythonDataType::Integer, "min_value"},
 			{mvPythonDataType::Integer, "max_value"},
 			{mvPythonDataType::String, "format"},
-			{mvPythonDataType::String, "callback", "Registers a callback"},
+			{mvPythonDataType::Callable, "callback", "Registers a callback"},
 			{mvPythonDataType::String, "tip", "Adds a simple tooltip"},
 			{mvPythonDataType::String, "parent", "Parent to add this item to. (runtime adding)"},
 			{mvPythonDataType::String, "before", "Item to add this item before. (runtime adding)"},
@@ -713,7 +777,7 @@ namespace Marvel {
 			{mvPythonDataType::Float, "min_value"},
 			{mvPythonDataType::Float, "max_value"},
 			{mvPythonDataType::String, "format"},
-			{mvPythonDataType::String, "callback", "Registers a callback"},
+			{mvPythonDataType::Callable, "callback", "Registers a callback"},
 			{mvPythonDataType::String, "tip", "Adds a simple tooltip"},
 			{mvPythonDataType::String, "parent", "Parent to add this item to. (runtime adding)"},
 			{mvPythonDataType::String, "before", "Item to add this item before. (runtime adding)"},
@@ -729,7 +793,7 @@ namespace Marvel {
 			{mvPythonDataType::Float, "min_value"},
 			{mvPythonDataType::Float, "max_value"},
 			{mvPythonDataType::String, "format"},
-			{mvPythonDataType::String, "callback", "Registers a callback"},
+			{mvPythonDataType::Callable, "callback", "Registers a callback"},
 			{mvPythonDataType::String, "tip", "Adds a simple tooltip"},
 			{mvPythonDataType::String, "parent", "Parent to add this item to. (runtime adding)"},
 			{mvPythonDataType::String, "before", "Item to add this item before. (runtime adding)"},
@@ -745,7 +809,7 @@ namespace Marvel {
 			{mvPythonDataType::Float, "min_value"},
 			{mvPythonDataType::Float, "max_value"},
 			{mvPythonDataType::String, "format"},
-			{mvPythonDataType::String, "callback", "Registers a callback"},
+			{mvPythonDataType::Callable, "callback", "Registers a callback"},
 			{mvPythonDataType::String, "tip", "Adds a simple tooltip"},
 			{mvPythonDataType::String, "parent", "Parent to add this item to. (runtime adding)"},
 			{mvPythonDataType::String, "before", "Item to add this item before. (runtime adding)"},
@@ -761,7 +825,7 @@ namespace Marvel {
 			{mvPythonDataType::Float, "min_value"},
 			{mvPythonDataType::Float, "max_value"},
 			{mvPythonDataType::String, "format"},
-			{mvPythonDataType::String, "callback", "Registers a callback"},
+			{mvPythonDataType::Callable, "callback", "Registers a callback"},
 			{mvPythonDataType::String, "tip", "Adds a simple tooltip"},
 			{mvPythonDataType::String, "parent", "Parent to add this item to. (runtime adding)"},
 			{mvPythonDataType::String, "before", "Item to add this item before. (runtime adding)"},
@@ -777,7 +841,7 @@ namespace Marvel {
 			{mvPythonDataType::Integer, "min_value"},
 			{mvPythonDataType::Integer, "max_value"},
 			{mvPythonDataType::String, "format"},
-			{mvPythonDataType::String, "callback", "Registers a callback"},
+			{mvPythonDataType::Callable, "callback", "Registers a callback"},
 			{mvPythonDataType::String, "tip", "Adds a simple tooltip"},
 			{mvPythonDataType::String, "parent", "Parent to add this item to. (runtime adding)"},
 			{mvPythonDataType::String, "before", "Item to add this item before. (runtime adding)"},
@@ -793,7 +857,7 @@ namespace Marvel {
 			{mvPythonDataType::Integer, "min_value"},
 			{mvPythonDataType::Integer, "max_value"},
 			{mvPythonDataType::String, "format"},
-			{mvPythonDataType::String, "callback", "Registers a callback"},
+			{mvPythonDataType::Callable, "callback", "Registers a callback"},
 			{mvPythonDataType::String, "tip", "Adds a simple tooltip"},
 			{mvPythonDataType::String, "parent", "Parent to add this item to. (runtime adding)"},
 			{mvPythonDataType::String, "before", "Item to add this item before. (runtime adding)"},
@@ -809,7 +873,7 @@ namespace Marvel {
 			{mvPythonDataType::Integer, "min_value"},
 			{mvPythonDataType::Integer, "max_value"},
 			{mvPythonDataType::String, "format"},
-			{mvPythonDataType::String, "callback", "Registers a callback"},
+			{mvPythonDataType::Callable, "callback", "Registers a callback"},
 			{mvPythonDataType::String, "tip", "Adds a simple tooltip"},
 			{mvPythonDataType::String, "parent", "Parent to add this item to. (runtime adding)"},
 			{mvPythonDataType::String, "before", "Item to add this item before. (runtime adding)"},
@@ -825,7 +889,7 @@ namespace Marvel {
 			{mvPythonDataType::Integer, "min_value"},
 			{mvPythonDataType::Integer, "max_value"},
 			{mvPythonDataType::String, "format"},
-			{mvPythonDataType::String, "callback", "Registers a callback"},
+			{mvPythonDataType::Callable, "callback", "Registers a callback"},
 			{mvPythonDataType::String, "tip", "Adds a simple tooltip"},
 			{mvPythonDataType::String, "parent", "Parent to add this item to. (runtime adding)"},
 			{mvPythonDataType::String, "before", "Item to add this item before. (runtime adding)"},
@@ -840,7 +904,7 @@ namespace Marvel {
 			{mvPythonDataType::String, "name"},
 			{mvPythonDataType::StringList, "headers"},
 			{mvPythonDataType::KeywordOnly},
-			{mvPythonDataType::String, "callback", "Registers a callback"},
+			{mvPythonDataType::Callable, "callback", "Registers a callback"},
 			{mvPythonDataType::String, "parent", "Parent to add this item to. (runtime adding)"},
 			{mvPythonDataType::String, "before","Item to add this item before. (runtime adding)"},
 		}, "Adds table.", "None", "Tables") });
@@ -852,6 +916,21 @@ namespace Marvel {
 			{mvPythonDataType::String, "value"},
 		}, "Sets a table's cell value.", "None", "Tables") });
 
+		parsers->insert({ "set_table_data", mvPythonParser({
+			{mvPythonDataType::String, "table"},
+			{mvPythonDataType::Object, "columns", "list of columns, each a list of values or a numeric buffer (i.e. numpy array)"},
+			{mvPythonDataType::Optional},
+			{mvPythonDataType::KeywordOnly},
+			{mvPythonDataType::StringList, "headers"},
+			{mvPythonDataType::StringList, "formats", "printf style format per buffer column (i.e. '%.2f')"},
+		}, "Replaces a table's data with columns.", "None", "Tables") });
+
+		parsers->insert({ "set_table_rows", mvPythonParser({
+			{mvPythonDataType::String, "table"},
+			{mvPythonDataType::Integer, "start"},
+			{mvPythonDataType::Object, "rows", "list of rows, each a list of values"},
+		}, "Replaces rows of a table starting at start, extending the table if needed.", "None", "Tables") });
+
 		parsers->insert({ "delete_row", mvPythonParser({
 			{mvPythonDataType::String, "table"},
 			{mvPythonDataType::Integer, "row"}
@@ -1032,7 +1111,7 @@ namespace Marvel {
 
 		parsers->insert({ "set_item_callback", mvPythonParser({
 			{mvPythonDataType::String, "item"},
-			{mvPythonDataType::String, "callback"}
+			{mvPythonDataType::Callable, "callback"}
 		}, "Sets an item's callback if applicable.", "None", "Widget Commands") });
 
 		parsers->insert({ "set_item_popup", mvPythonParser({
@@ -1365,7 +1444,7 @@ namespace Marvel {
 		parsers->insert({ "add_menu_item", mvPythonParser({
 			{mvPythonDataType::String, "name"},
 			{mvPythonDataType::KeywordOnly},
-			{mvPythonDataType::String, "callback", "Registers a callback"},
+			{mvPythonDataType::Callable, "callback", "Registers a callback"},
 			{mvPythonDataType::String, "tip", "Adds a simple tooltip"},
 			{mvPythonDataType::String, "parent", "Parent to add this item to. (runtime adding)"},
 			{mvPythonDataType::String, "before", "Item to add this item before. (runtime adding)"},
@@ -1462,7 +1541,7 @@ namespace Marvel {
 			{mvPythonDataType::StringList, "items"},
 			{mvPythonDataType::KeywordOnly},
 			{mvPythonDataType::Integer, "default_value"},
-			{mvPythonDataType::String, "callback", "Registers a callback"},
+			{mvPythonDataType::Callable, "callback", "Registers a callback"},
 			{mvPythonDataType::String, "tip", "Adds a simple tooltip"},
 			{mvPythonDataType::String, "parent", "Parent to add this item to. (runtime adding)"},
 			{mvPythonDataType::String, "before", "Item to add this item before. (runtime adding)"},
@@ -1477,7 +1556,7 @@ namespace Marvel {
 			{mvPythonDataType::StringList, "items"},
 			{mvPythonDataType::KeywordOnly},
 			{mvPythonDataType::String, "default_value"},
-			{mvPythonDataType::String, "callback", "Registers a callback"},
+			{mvPythonDataType::Callable, "callback", "Registers a callback"},
 			{mvPythonDataType::String, "tip", "Adds a simple tooltip"},
 			{mvPythonDataType::String, "parent", "Parent to add this item to. (runtime adding)"},
 			{mvPythonDataType::String, "before", "Item to add this item before. (runtime adding)"},
@@ -1490,7 +1569,7 @@ namespace Marvel {
 			{mvPythonDataType::String, "name"},
 			{mvPythonDataType::KeywordOnly},
 			{mvPythonDataType::Bool, "default_value"},
-			{mvPythonDataType::String, "callback", "Registers a callback"},
+			{mvPythonDataType::Callable, "callback", "Registers a callback"},
 			{mvPythonDataType::String, "tip", "Adds a simple tooltip"},
 			{mvPythonDataType::String, "parent", "Parent to add this item to. (runtime adding)"},
 			{mvPythonDataType::String, "before", "Item to add this item before. (runtime adding)"},
@@ -1503,7 +1582,7 @@ namespace Marvel {
 			{mvPythonDataType::Bool, "small", "Small button, useful for embedding in text."},
 			{mvPythonDataType::Bool, "arrow", "Arrow button."},
 			{mvPythonDataType::Integer, "direction", "A cardinal direction"},
-			{mvPythonDataType::String, "callback", "Registers a callback"},
+			{mvPythonDataType::Callable, "callback", "Registers a callback"},
 			{mvPythonDataType::String, "tip", "Adds a simple tooltip"},
 			{mvPythonDataType::String, "parent", "Parent to add this item to. (runtime adding)"},
 			{mvPythonDataType::String, "before", "Item to add this item before. (runtime adding)"},
@@ -1550,7 +1629,7 @@ namespace Marvel {
 			{mvPythonDataType::StringList, "items"},
 			{mvPythonDataType::KeywordOnly},
 			{mvPythonDataType::Integer, "default_value"},
-			{mvPythonDataType::String, "callback", "Registers a callback"},
+			{mvPythonDataType::Callable, "callback", "Registers a callback"},
 			{mvPythonDataType::String, "tip", "Adds a simple tooltip"},
 			{mvPythonDataType::String, "parent", "Parent to add this item to. (runtime adding)"},
 			{mvPythonDataType::String, "before", "Item to add this item before. (runtime adding)"},
@@ -1562,7 +1641,7 @@ namespace Marvel {
 			{mvPythonDataType::String, "name"},
 			{mvPythonDataType::KeywordOnly},
 			{mvPythonDataType::IntList, "default_value"},
-			{mvPythonDataType::String, "callback", "Registers a callback"},
+			{mvPythonDataType::Callable, "callback", "Registers a callback"},
 			{mvPythonDataType::String, "tip", "Adds a simple tooltip"},
 			{mvPythonDataType::String, "parent", "Parent to add this item to. (runtime adding)"},
 			{mvPythonDataType::String, "before", "Item to add this item before. (runtime adding)"},
@@ -1575,7 +1654,7 @@ namespace Marvel {
 			{mvPythonDataType::String, "name"},
 			{mvPythonDataType::KeywordOnly},
 			{mvPythonDataType::IntList, "default_value"},
-			{mvPythonDataType::String, "callback", "Registers a callback"},
+			{mvPythonDataType::Callable, "callback", "Registers a callback"},
 			{mvPythonDataType::String, "tip", "Adds a simple tooltip"},
 			{mvPythonDataType::String, "parent", "Parent to add this item to. (runtime adding)"},
 			{mvPythonDataType::String, "before", "Item to add this item before. (runtime adding)"},
@@ -1588,7 +1667,7 @@ namespace Marvel {
 			{mvPythonDataType::String, "name"},
 			{mvPythonDataType::KeywordOnly},
 			{mvPythonDataType::IntList, "default_value"},
-			{mvPythonDataType::String, "callback", "Registers a callback"},
+			{mvPythonDataType::Callable, "callback", "Registers a callback"},
 			{mvPythonDataType::String, "tip", "Adds a simple tooltip"},
 			{mvPythonDataType::String, "parent", "Parent to add this item to. (runtime adding)"},
 			{mvPythonDataType::String, "before", "Item to add this item before. (runtime adding)"},
@@ -1601,7 +1680,7 @@ namespace Marvel {
 			{mvPythonDataType::String, "name"},
 			{mvPythonDataType::KeywordOnly},
 			{mvPythonDataType::IntList, "default_value"},
-			{mvPythonDataType::String, "callback", "Registers a callback"},
+			{mvPythonDataType::Callable, "callback", "Registers a callback"},
 			{mvPythonDataType::String, "tip", "Adds a simple tooltip"},
 			{mvPythonDataType::String, "parent", "Parent to add this item to. (runtime adding)"},
 			{mvPythonDataType::String, "before", "Item to add this item before. (runtime adding)"},
@@ -1614,7 +1693,7 @@ namespace Marvel {
 			{mvPythonDataType::String, "name"},
 			{mvPythonDataType::KeywordOnly},
 			{mvPythonDataType::Integer, "default_value"},
-			{mvPythonDataType::String, "callback", "Registers a callback"},
+			{mvPythonDataType::Callable, "callback", "Registers a callback"},
 			{mvPythonDataType::String, "tip", "Adds a simple tooltip"},
 			{mvPythonDataType::String, "parent", "Parent to add this item to. (runtime adding)"},
 			{mvPythonDataType::String, "before", "Item to add this item before. (runtime adding)"},
@@ -1628,7 +1707,7 @@ namespace Marvel {
 			{mvPythonDataType::String, "name"},
 			{mvPythonDataType::KeywordOnly},
 			{mvPythonDataType::Bool, "reorderable", "allows for moveable tabs"},
-			{mvPythonDataType::String, "callback", "Registers a callback"},
+			{mvPythonDataType::Callable, "callback", "Registers a callback"},
 			{mvPythonDataType::String, "parent", "Parent to add this item to. (runtime adding)"},
 			{mvPythonDataType::String, "before", "Item to add this item before. (runtime adding)"},
 			{mvPythonDataType::String, "data_source", "data source for shared data"},
@@ -1795,18 +1874,18 @@ namespace Marvel {
 			{mvPythonDataType::String, "name"},
 			{mvPythonDataType::Object, "data"},
 			{mvPythonDataType::Optional},
-			{mvPythonDataType::String, "return_handler"},
+			{mvPythonDataType::Callable, "return_handler"},
 		}, "Runs a function asyncronously.") });
 
 		parsers->insert({ "open_file_dialog", mvPythonParser({
 			{mvPythonDataType::Optional},
-			{mvPythonDataType::String, "callback"},
+			{mvPythonDataType::Callable, "callback"},
 			{mvPythonDataType::String, "extensions", "filters items with extensions i.e '.*, .py'"},
 		}, "Opens an 'open file' dialog.") });
 
 		parsers->insert({ "select_directory_dialog", mvPythonParser({
 			{mvPythonDataType::Optional},
-			{mvPythonDataType::String, "callback"},
+			{mvPythonDataType::Callable, "callback"},
 		}, "Opens a select directory dialog.") });
 
 		parsers->insert({ "add_data", mvPythonParser({
@@ -1861,6 +1940,42 @@ namespace Marvel {
 			{mvPythonDataType::Integer, "width"},
 			{mvPythonDataType::Integer, "height"}
 		}, "Sets the main window size.") });
+
+		parsers->insert({ "set_power_saving_mode", mvPythonParser({
+			{mvPythonDataType::Bool, "value"}
+		}, "When enabled, frames (and render callbacks) only run on input, async returns, queued updates "
+			"or request_redraw. Otherwise the render loop sleeps.") });
+
+		parsers->insert({ "is_power_saving_mode", mvPythonParser({
+		}, "Checks if power saving mode is enabled.", "bool") });
+
+		parsers->insert({ "request_redraw", mvPythonParser({
+		}, "Renders a frame when in power saving mode. Can be called from any thread.") });
+
+		parsers->insert({ "set_profiling", mvPythonParser({
+			{mvPythonDataType::Bool, "value"}
+		}, "Starts or stops recording timing zones for each frame. Recorded frames are shown in the metrics window.") });
+
+		parsers->insert({ "is_profiling", mvPythonParser({
+		}, "Checks if timing zones are being recorded.", "bool") });
+
+		parsers->insert({ "get_profile_zones", mvPythonParser({
+		}, "Returns the timing zones of the last recorded frame as [name, start (ms), duration (ms), depth].", "List[List[Any]]") });
+
+		parsers->insert({ "export_profile_trace", mvPythonParser({
+			{mvPythonDataType::String, "file"}
+		}, "Writes the recorded frames to a file in the Chrome trace format (chrome://tracing).") });
+
+		parsers->insert({ "set_texture_upload_budget", mvPythonParser({
+			{mvPythonDataType::Integer, "bytes"}
+		}, "Sets how many bytes of decoded images are uploaded to the GPU each frame. At least one image is uploaded per frame.") });
+
+		parsers->insert({ "get_texture_upload_budget", mvPythonParser({
+		}, "Returns how many bytes of decoded images are uploaded to the GPU each frame.", "int") });
+
+		parsers->insert({ "set_texture_memory_budget", mvPythonParser({
+			{mvPythonDataType::Integer, "bytes"}
+		}, "Sets how much GPU memory textures may use before unused textures are released, least recently used first.") });
 	}
 
 	PyMODINIT_FUNC PyInit_dearpygui(void);
@@ -29,7 +29,7 @@ namespace Marvel {
     enum class mvPythonDataType
     {
         String, Integer, Float, Bool, StringList, FloatList, Optional,
-        Object, IntList, KeywordOnly
+        Object, IntList, KeywordOnly, Callable
     };
 
     //-----------------------------------------------------------------------------
@@ -75,6 +75,7 @@ namespace Marvel {
         std::vector<mvPythonDataElement> m_elements;
         std::vector<char>                m_formatstring;
         std::vector<const char*>         m_keywords;
+        std::vector<int>                 m_callbacks; // keyword indices of callback arguments
         bool                             m_optional = false; // check if optional has been found already
         bool                             m_keyword  = false; // check if keyword has been found already
         std::string                      m_about;
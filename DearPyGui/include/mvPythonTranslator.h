@@ -59,6 +59,7 @@ namespace Marvel {
 		static PyObject* ToPyList  (const std::vector<std::string>& value);
 		static PyObject* ToPyList  (const std::vector<std::vector<std::string>>& value);
 		static PyObject* ToPyList  (const std::vector<std::pair<int, int>>& value);
+		static PyObject* ToPyList  (const std::vector<std::pair<int, float>>& value);
 
 		// conversion to c++
 		static int         ToInt   (PyObject* value, const std::string& message = "Type must be an integer.");
@@ -70,13 +71,16 @@ namespace Marvel {
 
 		static std::vector<mvVec2>                              ToVectVec2           (PyObject* value, const std::string& message = "Type must be a list/tuple of list/tuple.");
 		static std::vector<int>                                 ToIntVect            (PyObject* value, const std::string& message = "Type must be a list or tuple of integers.");
-		static std::vector<float>                               ToFloatVect          (PyObject* value, const std::string& message = "Type must be a list or tuple of floats.");
-		static std::vector<std::string>                         ToStringVect         (PyObject* value, const std::string& message = "Type must be a list or tuple of strings.");
+		static std::vector<float>                               ToFloatVect          (PyObject* value, const std::string& message = "Type must be a list or tuple of floats.", bool* valid = nullptr);
+		static std::vector<std::string>                         ToStringVect         (PyObject* value, const std::string& message = "Type must be a list or tuple of strings.", const std::string& format = "", bool* valid = nullptr);
 		static std::vector<std::pair<int, int>>                 ToVectInt2           (PyObject* value, const std::string& message = "Type must be an list/tuple of integer.");
 		static std::vector<std::pair<std::string, std::string>> ToVectPairString     (PyObject* value, const std::string& message = "Type must be an list/tuple of string pairs.");
 		static std::vector<std::vector<std::string>>            ToVectVectString     (PyObject* value, const std::string& message = "Type must be an list/tuple of list/tuple of strings.");
 		static std::vector<std::pair<std::string, float>>       ToVectPairStringFloat(PyObject* value, const std::string& message = "Type must be an list/tuple of str,float pairs.");
 
+		// contiguous numeric buffers only, false (without raising) otherwise
+		static bool BufferToFloatVect(PyObject* value, std::vector<float>& items);
+
 	private:
 
 		mvPythonTranslator() = default;
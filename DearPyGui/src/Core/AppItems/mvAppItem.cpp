@@ -2,6 +2,7 @@
 #include "mvApp.h"
 #include "Core/mvInput.h"
 #include "Core/mvDataStorage.h"
+#include <algorithm>
 
 namespace Marvel{
 
@@ -45,86 +46,31 @@ namespace Marvel{
 
 	}
 
-	bool  mvAppItem::moveChildUp(const std::string& name)
+	bool mvAppItem::moveChildUp(mvAppItem* item)
 	{
-		bool found = false;
-		int index = 0;
-
-		// check children
-		for (size_t i = 0; i<m_children.size(); i++)
-		{
-
-			if (m_children[i]->getName() == name)
-			{
-				found = true;
-				index = i;
-				break;
-			}
-
-			if (m_children[i]->isContainer())
-			{
-				found = m_children[i]->moveChildUp(name);
-				if (found)
-					return true;
-			}
-
-		}
-
-		if (found)
+		for (size_t i = 0; i < m_children.size(); i++)
 		{
-			if (index > 0)
+			if (m_children[i] == item)
 			{
-				auto upperitem = m_children[index - 1];
-				auto loweritem = m_children[index];
-
-				m_children[index] = upperitem;
-				m_children[index-1] = loweritem;
+				if (i > 0)
+					std::swap(m_children[i], m_children[i - 1]);
+				return true;
 			}
-
-			return true;
 		}
 
 		return false;
-
 	}
 
-	bool  mvAppItem::moveChildDown(const std::string& name)
+	bool mvAppItem::moveChildDown(mvAppItem* item)
 	{
-		bool found = false;
-		int index = 0;
-
-		// check children
 		for (size_t i = 0; i < m_children.size(); i++)
 		{
-
-			if (m_children[i]->getName() == name)
-			{
-				found = true;
-				index = i;
-				break;
-			}
-
-			if (m_children[i]->isContainer())
-			{
-				found = m_children[i]->moveChildDown(name);
-				if (found)
-					return true;
-			}
-
-		}
-
-		if (found)
-		{
-			if (index < m_children.size()-1)
+			if (m_children[i] == item)
 			{
-				auto upperitem = m_children[index];
-				auto loweritem = m_children[index+1];
-
-				m_children[index] = loweritem;
-				m_children[index + 1] = upperitem;
+				if (i + 1 < m_children.size())
+					std::swap(m_children[i], m_children[i + 1]);
+				return true;
 			}
-
-			return true;
 		}
 
 		return false;
@@ -135,136 +81,56 @@ namespace Marvel{
 
 		updateData(name);
 
-		if (name == m_dataSource)
-			setPyValue(mvDataStorage::GetData(name));
+		if (name != m_dataSource)
+			return;
 
-		for (auto child : m_children)
-			child->updateDataSource(name);
+		const mvDataValue* value = mvDataStorage::GetValue(name);
+		if (value == nullptr || setDataValue(*value))
+			return;
+
+		PyObject* data = mvDataStorage::GetData(name);
+		setPyValue(data);
+
+		mvGlobalIntepreterLock gil;
+		Py_XDECREF(data);
 	}
 
-	bool mvAppItem::addRuntimeChild(const std::string& parent, const std::string& before, mvAppItem* item)
+	bool mvAppItem::addRuntimeChild(mvAppItem* item, mvAppItem* before)
 	{
-		if (before.empty() && parent.empty())
-			return false;
-
-		//this is the container, add item to beginning.
-		if (before.empty())
+		// no before item, add item to the end
+		if (before == nullptr)
 		{
-			if (parent == m_name)
-			{
-				m_children.push_back(item);
-				item->setParent(this);
-				return true;
-			}
-
-			else
-			{
-				// check children
-				for (mvAppItem* child : m_children)
-				{
-					if (child->isContainer())
-					{
-						// parent found
-						if (child->addRuntimeChild(parent, before, item))
-							return true;
-					}
-				}
-			}
+			m_children.push_back(item);
+			item->setParent(this);
+			return true;
 		}
 
-		else
+		for (auto it = m_children.begin(); it != m_children.end(); ++it)
 		{
-			bool beforeFound = false;
-
-			// check children
-			for (mvAppItem* child : m_children)
-			{
-
-				if (child->getName() == before)
-				{
-					beforeFound = true;
-					break;
-				}
-
-			}
-
-			// after item is in this container
-			if (beforeFound)
+			if (*it == before)
 			{
+				m_children.insert(it, item);
 				item->setParent(this);
-
-				std::vector<mvAppItem*> oldchildren = m_children;
-				m_children.clear();
-
-				for (auto child : oldchildren)
-				{
-					if (child->getName() == before)
-						m_children.push_back(item);
-					m_children.push_back(child);
-
-				}
-
 				return true;
 			}
 		}
 
-		// check children
-		for (mvAppItem* child : m_children)
-		{
-			if (child->isContainer())
-			{
-				// parent found
-				if (child->addRuntimeChild(parent, before, item))
-					return true;
-			}
-		}
-
 		return false;
 	}
 
-	bool mvAppItem::deleteChild(const std::string& name)
+	bool mvAppItem::deleteChild(mvAppItem* item)
 	{
-
-		bool childfound = false;
-		bool itemDeleted = false;
-
-		for (mvAppItem* item : m_children)
+		for (auto it = m_children.begin(); it != m_children.end(); ++it)
 		{
-			if (item->getName() == name)
-			{
-				childfound = true;
-				break;
-			}
-
-			if (item->isContainer())
+			if (*it == item)
 			{
-				itemDeleted = item->deleteChild(name);
-				if (itemDeleted)
-					break;
-			}
-		}
-
-		if (childfound)
-		{
-			std::vector<mvAppItem*> oldchildren = m_children;
-
-			m_children.clear();
-
-			for (auto& item : oldchildren)
-			{
-				if (item->getName() == name)
-				{
-					delete item;
-					item = nullptr;
-					itemDeleted = true;
-					continue;
-				}
-
-				m_children.push_back(item);
+				m_children.erase(it);
+				delete item;
+				return true;
 			}
 		}
 
-		return itemDeleted;
+		return false;
 	}
 
 	void mvAppItem::deleteChildren()
@@ -343,6 +209,12 @@ namespace Marvel{
 	mvAppItem::~mvAppItem()
 	{
 		deleteChildren();
+		ReleaseCallback(m_callback);
+	}
+
+	void mvAppItem::setCallback(const std::string& callback)
+	{
+		ReplaceCallback(m_callback, callback);
 	}
 
 }
\ No newline at end of file
@@ -63,7 +63,7 @@ namespace Marvel {
 			{
 
 				if (!m_dataSource.empty())
-					mvDataStorage::AddData(m_dataSource, getPyValue());
+					mvDataStorage::AddData(m_dataSource, getDataValue());
 
 				mvApp::GetApp()->runCallback(m_callback, m_name);
 
@@ -162,7 +162,7 @@ namespace Marvel {
 			if (ImGui::Checkbox(m_label.c_str(), &m_value))
 			{
 				if (!m_dataSource.empty())
-					mvDataStorage::AddData(m_dataSource, getPyValue());
+					mvDataStorage::AddData(m_dataSource, getDataValue());
 
 				mvApp::GetApp()->runCallback(m_callback, m_name);
 
@@ -200,7 +200,7 @@ namespace Marvel {
 					if (ImGui::Selectable((name + "##" + m_name).c_str(), is_selected))
 					{
 						if (!m_dataSource.empty())
-							mvDataStorage::AddData(m_dataSource, getPyValue());
+							mvDataStorage::AddData(m_dataSource, getDataValue());
 
 						m_value = name;
 						mvApp::GetApp()->runCallback(m_callback, m_name);
@@ -219,15 +219,28 @@ namespace Marvel {
 			}
 		}
 
+		std::string getSecondaryDataSource() const override { return m_listDataSource; }
+
 		void updateData(const std::string& name) override
 		{
 			if (name == m_listDataSource)
 			{
-				PyObject* data = mvDataStorage::GetData(name);
-				if (data == nullptr)
+				const mvDataValue* value = mvDataStorage::GetValue(name);
+				if (value == nullptr)
 					return;
 
-				m_names = mvPythonTranslator::ToStringVect(data);
+				if (value->type == mvDataType::StringList)
+					m_names = value->strings;
+
+				// i.e. empty or mixed lists
+				else if (value->type == mvDataType::Object)
+				{
+					PyObject* data = mvDataStorage::GetData(name);
+					m_names = mvPythonTranslator::ToStringVect(data);
+
+					mvGlobalIntepreterLock gil;
+					Py_XDECREF(data);
+				}
 			}
 		}
 
@@ -263,7 +276,7 @@ namespace Marvel {
 			if (ImGui::ListBox(m_label.c_str(), &m_value[0], m_charNames.data(), m_names.size(), m_itemsHeight))
 			{
 				if (!m_dataSource.empty())
-					mvDataStorage::AddData(m_dataSource, getPyValue());
+					mvDataStorage::AddData(m_dataSource, getDataValue());
 
 				mvApp::GetApp()->runCallback(m_callback, m_name);
 
@@ -273,15 +286,28 @@ namespace Marvel {
 			}
 		}
 
+		std::string getSecondaryDataSource() const override { return m_listDataSource; }
+
 		void updateData(const std::string& name) override
 		{
 			if (name == m_listDataSource)
 			{
-				PyObject* data = mvDataStorage::GetData(name);
-				if (data == nullptr)
+				const mvDataValue* value = mvDataStorage::GetValue(name);
+				if (value == nullptr)
 					return;
 
-				m_names = mvPythonTranslator::ToStringVect(data);
+				if (value->type == mvDataType::StringList)
+					m_names = value->strings;
+
+				// i.e. empty or mixed lists
+				else if (value->type == mvDataType::Object)
+				{
+					PyObject* data = mvDataStorage::GetData(name);
+					m_names = mvPythonTranslator::ToStringVect(data);
+
+					mvGlobalIntepreterLock gil;
+					Py_XDECREF(data);
+				}
 				m_charNames.clear();
 				for (const std::string& item : m_names)
 					m_charNames.emplace_back(item.c_str());
@@ -320,7 +346,7 @@ namespace Marvel {
 				if (ImGui::RadioButton((m_itemnames[i] + "##" + m_name).c_str(), &m_value[0], i))
 				{
 					if (!m_dataSource.empty())
-						mvDataStorage::AddData(m_dataSource, getPyValue());
+						mvDataStorage::AddData(m_dataSource, getDataValue());
 
 					mvApp::GetApp()->runCallback(m_callback, m_name);
 
@@ -332,15 +358,28 @@ namespace Marvel {
 
 		}
 
+		std::string getSecondaryDataSource() const override { return m_listDataSource; }
+
 		void updateData(const std::string& name) override
 		{
 			if (name == m_listDataSource)
 			{
-				PyObject* data = mvDataStorage::GetData(name);
-				if (data == nullptr)
+				const mvDataValue* value = mvDataStorage::GetValue(name);
+				if (value == nullptr)
 					return;
 
-				m_itemnames = mvPythonTranslator::ToStringVect(data);
+				if (value->type == mvDataType::StringList)
+					m_itemnames = value->strings;
+
+				// i.e. empty or mixed lists
+				else if (value->type == mvDataType::Object)
+				{
+					PyObject* data = mvDataStorage::GetData(name);
+					m_itemnames = mvPythonTranslator::ToStringVect(data);
+
+					mvGlobalIntepreterLock gil;
+					Py_XDECREF(data);
+				}
 			}
 		}
 
@@ -402,7 +441,7 @@ namespace Marvel {
 			if (ImGui::InputInt(m_label.c_str(), m_value.data()))
 			{
 				if (!m_dataSource.empty())
-					mvDataStorage::AddData(m_dataSource, getPyValue());
+					mvDataStorage::AddData(m_dataSource, getDataValue());
 
 				mvApp::GetApp()->runCallback(m_callback, m_name);
 
@@ -435,7 +474,7 @@ namespace Marvel {
 			if (imguicommand(m_label.c_str(), m_value.data(), 0))
 			{
 				if (!m_dataSource.empty())
-					mvDataStorage::AddData(m_dataSource, getPyValue());
+					mvDataStorage::AddData(m_dataSource, getDataValue());
 
 				mvApp::GetApp()->runCallback(m_callback, m_name);
 
@@ -468,7 +507,7 @@ namespace Marvel {
 			if (ImGui::InputFloat(m_label.c_str(), m_value.data(), 0.0f, 0.0f, m_format.c_str()))
 			{
 				if (!m_dataSource.empty())
-					mvDataStorage::AddData(m_dataSource, getPyValue());
+					mvDataStorage::AddData(m_dataSource, getDataValue());
 
 				mvApp::GetApp()->runCallback(m_callback, m_name);
 
@@ -505,7 +544,7 @@ namespace Marvel {
 			if (imguicommand(m_label.c_str(), m_value.data(), m_format.c_str(), 0))
 			{
 				if (!m_dataSource.empty())
-					mvDataStorage::AddData(m_dataSource, getPyValue());
+					mvDataStorage::AddData(m_dataSource, getDataValue());
 
 				mvApp::GetApp()->runCallback(m_callback, m_name);
 
@@ -544,7 +583,7 @@ namespace Marvel {
 			if (imguicommand(m_label.c_str(), m_value.data(), m_speed, m_min, m_max, m_format.c_str(), 0))
 			{
 				if (!m_dataSource.empty())
-					mvDataStorage::AddData(m_dataSource, getPyValue());
+					mvDataStorage::AddData(m_dataSource, getDataValue());
 
 				mvApp::GetApp()->runCallback(m_callback, m_name);
 
@@ -586,7 +625,7 @@ namespace Marvel {
 			if (imguicommand(m_label.c_str(), m_value.data(), m_speed, m_min, m_max, m_format.c_str(), 0))
 			{
 				if (!m_dataSource.empty())
-					mvDataStorage::AddData(m_dataSource, getPyValue());
+					mvDataStorage::AddData(m_dataSource, getDataValue());
 
 				mvApp::GetApp()->runCallback(m_callback, m_name);
 
@@ -634,7 +673,7 @@ namespace Marvel {
 				if (ImGui::VSliderFloat(m_label.c_str(), ImVec2((float)m_width, (float)m_height), m_value.data(), m_min, m_max, m_format.c_str()))
 				{
 					if (!m_dataSource.empty())
-						mvDataStorage::AddData(m_dataSource, getPyValue());
+						mvDataStorage::AddData(m_dataSource, getDataValue());
 
 					mvApp::GetApp()->runCallback(m_callback, m_name);
 
@@ -648,7 +687,7 @@ namespace Marvel {
 				if (ImGui::SliderFloat(m_label.c_str(), m_value.data(), m_min, m_max, m_format.c_str()))
 				{
 					if (!m_dataSource.empty())
-						mvDataStorage::AddData(m_dataSource, getPyValue());
+						mvDataStorage::AddData(m_dataSource, getDataValue());
 
 					mvApp::GetApp()->runCallback(m_callback, m_name);
 
@@ -696,7 +735,7 @@ namespace Marvel {
 				if (ImGui::VSliderInt(m_label.c_str(), ImVec2((float)m_width, (float)m_height), m_value.data(), m_min, m_max, m_format.c_str()))
 				{
 					if (!m_dataSource.empty())
-						mvDataStorage::AddData(m_dataSource, getPyValue());
+						mvDataStorage::AddData(m_dataSource, getDataValue());
 
 					mvApp::GetApp()->runCallback(m_callback, m_name);
 
@@ -710,7 +749,7 @@ namespace Marvel {
 				if (ImGui::SliderInt(m_label.c_str(), m_value.data(), m_min, m_max, m_format.c_str()))
 				{
 					if (!m_dataSource.empty())
-						mvDataStorage::AddData(m_dataSource, getPyValue());
+						mvDataStorage::AddData(m_dataSource, getDataValue());
 
 					mvApp::GetApp()->runCallback(m_callback, m_name);
 
@@ -752,7 +791,7 @@ namespace Marvel {
 			if (imguicommand(m_label.c_str(), m_value.data(), m_min, m_max, m_format.c_str(), 0))
 			{
 				if (!m_dataSource.empty())
-					mvDataStorage::AddData(m_dataSource, getPyValue());
+					mvDataStorage::AddData(m_dataSource, getDataValue());
 
 				mvApp::GetApp()->runCallback(m_callback, m_name);
 
@@ -792,7 +831,7 @@ namespace Marvel {
 			if (imguicommand(m_label.c_str(), m_value.data(), m_min, m_max, m_format.c_str(), 0))
 			{
 				if (!m_dataSource.empty())
-					mvDataStorage::AddData(m_dataSource, getPyValue());
+					mvDataStorage::AddData(m_dataSource, getDataValue());
 
 				mvApp::GetApp()->runCallback(m_callback, m_name);
 
@@ -37,7 +37,7 @@ namespace Marvel {
 			if (imguicommand(m_label.c_str(), m_value.data(), 0))
 			{
 				if (!m_dataSource.empty())
-					mvDataStorage::AddData(m_dataSource, getPyValue());
+					mvDataStorage::AddData(m_dataSource, getDataValue());
 
 				mvApp::GetApp()->runCallback(m_callback, m_name);
 
@@ -69,7 +69,7 @@ namespace Marvel {
 			if (ImGui::ColorPicker4(m_label.c_str(), m_value.data()))
 			{
 				if (!m_dataSource.empty())
-					mvDataStorage::AddData(m_dataSource, getPyValue());
+					mvDataStorage::AddData(m_dataSource, getDataValue());
 
 				mvApp::GetApp()->runCallback(m_callback, m_name);
 
@@ -1,6 +1,7 @@
 #pragma once
 
 #include "Core/AppItems/mvTypeBases.h"
+#include "Core/mvProfiler.h"
 #include "mvEventHandler.h"
 #include "Core/mvInput.h"
 
@@ -48,6 +49,7 @@ namespace Marvel {
 					ImGui::SetNextItemWidth((float)item->getWidth());
 
 				item->pushColorStyles();
+				MV_PROFILE_SCOPE(item->getName());
 				item->draw();
 				item->popColorStyles();
 
@@ -127,6 +129,7 @@ namespace Marvel {
 					ImGui::SetNextItemWidth((float)item->getWidth());
 
 				item->pushColorStyles();
+				MV_PROFILE_SCOPE(item->getName());
 				item->draw();
 				item->popColorStyles();
 
@@ -203,6 +206,7 @@ namespace Marvel {
 						ImGui::SetNextItemWidth((float)item->getWidth());
 
 					item->pushColorStyles();
+					MV_PROFILE_SCOPE(item->getName());
 					item->draw();
 					item->popColorStyles();
 
@@ -269,6 +273,7 @@ namespace Marvel {
 						ImGui::SetNextItemWidth((float)item->getWidth());
 
 					item->pushColorStyles();
+					MV_PROFILE_SCOPE(item->getName());
 					item->draw();
 					item->popColorStyles();
 
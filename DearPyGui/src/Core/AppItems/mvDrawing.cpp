@@ -1,6 +1,9 @@
 #include "mvDrawing.h"
+#include "Core/mvProfiler.h"
+#include "Core/mvTriangulator.h"
 
 #include <cmath>
+#include <cfloat>
 #include <algorithm>
 
 #undef min
@@ -8,39 +11,182 @@
 
 namespace Marvel {
 
+	mvDrawingStats mvDrawing::s_stats;
+	mvDrawingStats mvDrawing::s_lastStats;
+	int            mvDrawing::s_statsFrame = -1;
+
+	static void BoundsOf(const mvVec2* points, size_t count, float thickness, ImVec2& pmin, ImVec2& pmax)
+	{
+		pmin = { FLT_MAX, FLT_MAX };
+		pmax = { -FLT_MAX, -FLT_MAX };
+		for (size_t i = 0; i < count; i++)
+		{
+			pmin = { std::min(pmin.x, points[i].x), std::min(pmin.y, points[i].y) };
+			pmax = { std::max(pmax.x, points[i].x), std::max(pmax.y, points[i].y) };
+		}
+
+		// line width and anti-aliasing fringe
+		float margin = thickness * 0.5f + 1.0f;
+		pmin = { pmin.x - margin, pmin.y - margin };
+		pmax = { pmax.x + margin, pmax.y + margin };
+	}
+
+	// packed x, y pairs
+	static void BoundsOf(const std::vector<float>& points, float thickness, ImVec2& pmin, ImVec2& pmax)
+	{
+		BoundsOf((const mvVec2*)points.data(), points.size() / 2, thickness, pmin, pmax);
+	}
+
+	bool mvDrawImageCommand::getBounds(ImVec2& pmin, ImVec2& pmax) const
+	{
+		// size is unknown until the texture is loaded (autosize)
+		return false;
+	}
+
+	bool mvDrawLineCommand::getBounds(ImVec2& pmin, ImVec2& pmax) const
+	{
+		mvVec2 points[] = { m_p1, m_p2 };
+		BoundsOf(points, 2, m_thickness, pmin, pmax);
+		return true;
+	}
+
+	bool mvDrawArrowCommand::getBounds(ImVec2& pmin, ImVec2& pmax) const
+	{
+		mvVec2 points[] = { m_p1, m_p2, m_points[0], m_points[1], m_points[2] };
+		BoundsOf(points, 5, m_thickness, pmin, pmax);
+		return true;
+	}
+
+	bool mvDrawTriangleCommand::getBounds(ImVec2& pmin, ImVec2& pmax) const
+	{
+		mvVec2 points[] = { m_p1, m_p2, m_p3 };
+		BoundsOf(points, 3, m_thickness, pmin, pmax);
+		return true;
+	}
+
+	bool mvDrawCircleCommand::getBounds(ImVec2& pmin, ImVec2& pmax) const
+	{
+		mvVec2 points[] = { { m_center.x - m_radius, m_center.y - m_radius }, { m_center.x + m_radius, m_center.y + m_radius } };
+		BoundsOf(points, 2, m_thickness, pmin, pmax);
+		return true;
+	}
+
+	bool mvDrawTextCommand::getBounds(ImVec2& pmin, ImVec2& pmax) const
+	{
+		ImFont* font = ImGui::GetFont();
+		ImVec2 size = font->CalcTextSizeA((float)m_size, FLT_MAX, 0.0f, m_text.c_str());
+		pmin = { m_pos.x, m_pos.y };
+		pmax = { m_pos.x + size.x, m_pos.y + size.y };
+		return true;
+	}
+
+	bool mvDrawRectCommand::getBounds(ImVec2& pmin, ImVec2& pmax) const
+	{
+		mvVec2 points[] = { m_pmin, m_pmax };
+		BoundsOf(points, 2, m_thickness, pmin, pmax);
+		return true;
+	}
+
+	bool mvDrawQuadCommand::getBounds(ImVec2& pmin, ImVec2& pmax) const
+	{
+		mvVec2 points[] = { m_p1, m_p2, m_p3, m_p4 };
+		BoundsOf(points, 4, m_thickness, pmin, pmax);
+		return true;
+	}
+
+	bool mvDrawPolylineCommand::getBounds(ImVec2& pmin, ImVec2& pmax) const
+	{
+		BoundsOf(m_points.data(), m_points.size(), m_thickness, pmin, pmax);
+		return !m_points.empty();
+	}
+
+	bool mvDrawPolygonCommand::getBounds(ImVec2& pmin, ImVec2& pmax) const
+	{
+		BoundsOf(m_points.data(), m_points.size(), m_thickness, pmin, pmax);
+		return !m_points.empty();
+	}
+
+	bool mvDrawBezierCurveCommand::getBounds(ImVec2& pmin, ImVec2& pmax) const
+	{
+		// the curve stays inside its control points
+		mvVec2 points[] = { m_p1, m_p2, m_p3, m_p4 };
+		BoundsOf(points, 4, m_thickness, pmin, pmax);
+		return true;
+	}
+
+	bool mvDrawCirclesCommand::getBounds(ImVec2& pmin, ImVec2& pmax) const
+	{
+		if (m_centers.empty())
+			return false;
+
+		float radius = *std::max_element(m_radii.begin(), m_radii.end());
+		BoundsOf(m_centers, m_thickness + radius * 2.0f, pmin, pmax);
+		return true;
+	}
+
+	bool mvDrawLinesCommand::getBounds(ImVec2& pmin, ImVec2& pmax) const
+	{
+		BoundsOf(m_points, m_thickness, pmin, pmax);
+		return !m_points.empty();
+	}
+
+	bool mvDrawRectsCommand::getBounds(ImVec2& pmin, ImVec2& pmax) const
+	{
+		BoundsOf(m_points, m_thickness, pmin, pmax);
+		return !m_points.empty();
+	}
+
 	mvDrawImageCommand::~mvDrawImageCommand()
 	{
-		mvTextureStorage::DecrementTexture(m_file);
+		if (m_added)
+			mvTextureStorage::DecrementTexture(m_file);
 	}
 
 	void mvDrawImageCommand::draw(mvDrawing* draw, ImDrawList* draw_list)
 	{
 		if (m_texture == nullptr && !m_file.empty())
 		{
-			mvTextureStorage::AddTexture(m_file);
+			// decoded in the background, drawn once uploaded
+			if (!m_added)
+			{
+				mvTextureStorage::AddTexture(m_file);
+				m_added = true;
+			}
+
 			mvTexture* texture = mvTextureStorage::GetTexture(m_file);
-            if(texture == nullptr)
-            {
-                PyErr_Format(PyExc_Exception,
-                                            "Image %s could not be found for draw_image. Check the path to the image "
-                                            "you provided.", m_file.c_str());
-                PyErr_Print();
-                m_file = "";
-                return;
-            }
-			if (m_width == 0) m_width = (int)((float)texture->width * (m_uv_max.x - m_uv_min.x));
-			if (m_height == 0) m_height = (int)((float)texture->height * (m_uv_max.y - m_uv_min.y));
+			if(texture == nullptr || texture->failed)
+			{
+				mvGlobalIntepreterLock gil;
+				PyErr_Format(PyExc_Exception,
+					"Image %s could not be found for draw_image. Check the path to the image "
+					"you provided.", m_file.c_str());
+				PyErr_Print();
+				mvTextureStorage::DecrementTexture(m_file);
+				m_added = false;
+				m_file = "";
+				return;
+			}
+
+			if (texture->texture)
+			{
+				if (m_width == 0) m_width = (int)((float)texture->width * (m_uv_max.x - m_uv_min.x));
+				if (m_height == 0) m_height = (int)((float)texture->height * (m_uv_max.y - m_uv_min.y));
 
-			m_texture = texture->texture;
+				m_texture = texture->texture;
 
-			if (m_autosize)
-				m_pmax = { (float)m_width + m_pmin.x, (float)m_height + m_pmin.y };
+				if (m_autosize)
+					m_pmax = { (float)m_width + m_pmin.x, (float)m_height + m_pmin.y };
+			}
 
 		}
 
 		mvVec2 start = draw->getStart();
 		if(m_texture)
 			draw_list->AddImage(m_texture, m_pmin + start, m_pmax+start, m_uv_min, m_uv_max, m_color);
+
+		// placeholder while the image is loading, autosized images have no size yet
+		else if (!m_file.empty() && !m_autosize)
+			draw_list->AddRectFilled(m_pmin + start, m_pmax + start, ImGui::GetColorU32(ImGuiCol_FrameBg));
 	}
 
 	void mvDrawLineCommand::draw(mvDrawing* draw, ImDrawList* draw_list)
@@ -109,95 +255,101 @@ namespace Marvel {
 	{
 		mvVec2 start = draw->getStart();
 
-		std::vector<mvVec2> points = m_points;
-
-		for (auto& point : points)
-			point = point + start;
+		std::vector<mvVec2>& points = draw->getPointBuffer();
+		points.resize(m_points.size());
+		for (size_t i = 0; i < m_points.size(); i++)
+			points[i] = m_points[i] + start;
 
 		draw_list->AddPolyline((const ImVec2*)const_cast<const mvVec2*>(points.data()), m_points.size(), m_color, m_closed, m_thickness);
 	}
 
 	void mvDrawPolygonCommand::draw(mvDrawing* draw, ImDrawList* draw_list)
 	{
-        mvVec2 start = draw->getStart();
-        std::vector<mvVec2> points = m_points;
-        for (auto& point : points)
-            point = point + start;
-        draw_list->AddPolyline((const ImVec2*)const_cast<const mvVec2*>(points.data()), m_points.size(), m_color, false, m_thickness);
+		mvVec2 start = draw->getStart();
 
 		if (m_fill.specified)
+			AddTriangulatedPolygonFilled(draw_list, m_fillPoints, m_fillIndices, m_fill, start);
+
+		std::vector<mvVec2>& points = draw->getPointBuffer();
+		points.resize(m_points.size());
+		for (size_t i = 0; i < m_points.size(); i++)
+			points[i] = m_points[i] + start;
+
+		draw_list->AddPolyline((const ImVec2*)const_cast<const mvVec2*>(points.data()), m_points.size(), m_color, false, m_thickness);
+	}
+
+	void mvDrawCirclesCommand::draw(mvDrawing* draw, ImDrawList* draw_list)
+	{
+		mvVec2 start = draw->getStart();
+
+		// single values apply to every circle
+		size_t count = m_centers.size() / 2;
+		size_t radiusStride = m_radii.size() == 1 ? 0 : 1;
+		size_t colorStride = m_colors.size() == 1 ? 0 : 1;
+		size_t fillStride = m_fills.size() == 1 ? 0 : 1;
+
+		for (size_t i = 0; i < count; i++)
 		{
-			int i;
-			int y;
-			int miny, maxy;
-			int x1, y1;
-			int x2, y2;
-			int ind1, ind2;
-			int ints;
-			size_t n = m_points.size();
-			int* polyints = new int[n];
-
-			/* Determine Y maxima */
-			miny = (int)m_points[0].y;
-			maxy = (int)m_points[0].y;
-			for (i = 1; i < n; i++)
-			{
-				miny = std::min(miny, (int)m_points[i].y);
-				maxy = std::max(maxy, (int)m_points[i].y);
-			}
+			float radius = m_radii[i * radiusStride];
+			float x = m_centers[i * 2];
+			float y = m_centers[i * 2 + 1];
+			if (!draw->isVisible({ x - radius - m_thickness, y - radius - m_thickness }, { x + radius + m_thickness, y + radius + m_thickness }))
+				continue;
 
-			/* Draw, scanning y */
-			for (y = miny; y <= maxy; y++) {
-				ints = 0;
-				for (i = 0; (i < n); i++) {
-					if (!i)
-					{
-						ind1 = (int)n - 1;
-						ind2 = 0;
-					}
-					else
-					    {
-						ind1 = i - 1;
-						ind2 = i;
-					}
-					y1 = (int)m_points[ind1].y;
-					y2 = (int)m_points[ind2].y;
-					if (y1 < y2)
-					{
-						x1 = (int)m_points[ind1].x;
-						x2 = (int)m_points[ind2].x;
-					}
-					else if (y1 > y2)
-					{
-						y2 = (int)m_points[ind1].y;
-						y1 = (int)m_points[ind2].y;
-						x2 = (int)m_points[ind1].x;
-						x1 = (int)m_points[ind2].x;
-					}
-					else
-						continue;
+			ImVec2 center(x + start.x, y + start.y);
 
-					if (((y >= y1) && (y < y2)) || ((y == maxy) && (y > y1) && (y <= y2)))
-						polyints[ints++] = (y - y1) * (x2 - x1) / (y2 - y1) + x1;
+			if (!m_fills.empty())
+				draw_list->AddCircleFilled(center, radius, m_fills[i * fillStride], m_segments);
 
-				}
+			draw_list->AddCircle(center, radius, m_colors[i * colorStride], m_segments, m_thickness);
+		}
+	}
 
-				auto compare_int = [](const void* a, const void* b)
-				{
-					return (*(const int*)a) - (*(const int*)b);
-				};
+	void mvDrawLinesCommand::draw(mvDrawing* draw, ImDrawList* draw_list)
+	{
+		mvVec2 start = draw->getStart();
 
-				qsort(polyints, ints, sizeof(int), compare_int);
+		size_t count = m_points.size() / 4;
+		size_t colorStride = m_colors.size() == 1 ? 0 : 1;
 
-				for (i = 0; i < ints; i += 2) 
-				{
-					draw_list->AddLine({ (float)polyints[i] + start.x, (float)y + start.y },
-						{ (float)polyints[i+1] + start.x, (float)y + start.y }, m_fill, m_thickness);
-				}
-			}
-			delete[] polyints;
+		for (size_t i = 0; i < count; i++)
+		{
+			const float* line = &m_points[i * 4];
+			if (!draw->isVisible({ std::min(line[0], line[2]) - m_thickness, std::min(line[1], line[3]) - m_thickness },
+				{ std::max(line[0], line[2]) + m_thickness, std::max(line[1], line[3]) + m_thickness }))
+				continue;
+
+			draw_list->AddLine(ImVec2(line[0] + start.x, line[1] + start.y), ImVec2(line[2] + start.x, line[3] + start.y),
+				m_colors[i * colorStride], m_thickness);
 		}
+	}
 
+	void mvDrawRectsCommand::draw(mvDrawing* draw, ImDrawList* draw_list)
+	{
+		mvVec2 start = draw->getStart();
+
+		size_t count = m_points.size() / 4;
+		size_t colorStride = m_colors.size() == 1 ? 0 : 1;
+		size_t fillStride = m_fills.size() == 1 ? 0 : 1;
+
+		for (size_t i = 0; i < count; i++)
+		{
+			const float* rect = &m_points[i * 4];
+
+			// y is flipped by the model space conversion
+			ImVec2 pmin(std::min(rect[0], rect[2]), std::min(rect[1], rect[3]));
+			ImVec2 pmax(std::max(rect[0], rect[2]), std::max(rect[1], rect[3]));
+			if (!draw->isVisible({ pmin.x - m_thickness, pmin.y - m_thickness }, { pmax.x + m_thickness, pmax.y + m_thickness }))
+				continue;
+
+			pmin = { pmin.x + start.x, pmin.y + start.y };
+			pmax = { pmax.x + start.x, pmax.y + start.y };
+
+			if (!m_fills.empty())
+				draw_list->AddRectFilled(pmin, pmax, m_fills[i * fillStride], m_rounding, ImDrawCornerFlags_All);
+
+			draw_list->AddRect(pmin, pmax, m_colors[i * colorStride], m_rounding, ImDrawCornerFlags_All, m_thickness);
+		}
 	}
 
 	void mvDrawing::draw()
@@ -207,19 +359,388 @@ namespace Marvel {
 		m_startx = (float)ImGui::GetCursorScreenPos().x;
 		m_starty = (float)ImGui::GetCursorScreenPos().y;
 
-		if (m_dirty)
+		ImGui::PushClipRect({ m_startx, m_starty }, { m_startx + (float)m_width, m_starty + (float)m_height }, true);
+
+		if (m_transformHeight != m_height)
+			m_dirty = true;
+
+		// commands changing every frame are drawn directly, the cache
+		// is only built once they stop changing
+		bool changed = m_dirty;
+		if (changed)
+		{
 			updateCommands();
+			m_cacheValid = false;
+		}
+		else if (!m_cacheValid)
+			buildCache();
+
+		// visible part of the canvas (intersected with the window)
+		ImVec2 clipMin = draw_list->GetClipRectMin();
+		ImVec2 clipMax = draw_list->GetClipRectMax();
+		m_visibleMin = { clipMin.x - m_startx, clipMin.y - m_starty };
+		m_visibleMax = { clipMax.x - m_startx, clipMax.y - m_starty };
+		bool clipped = m_visibleMin.x > 0.0f || m_visibleMin.y > 0.0f || m_visibleMax.x < (float)m_width || m_visibleMax.y < (float)m_height;
+
+		int frame = ImGui::GetFrameCount();
+		if (frame != s_statsFrame)
+		{
+			s_lastStats = s_statsFrame == frame - 1 ? s_stats : mvDrawingStats();
+			s_stats = mvDrawingStats();
+			s_statsFrame = frame;
+		}
+		s_stats.drawings++;
 
-		ImGui::PushClipRect({ m_startx, m_starty }, { m_startx + (float)m_width, m_starty + (float)m_height }, true);
+		if (!clipped)
+		{
+			s_stats.submitted += (int)m_commands.size();
 
-		for (auto command : m_commands)
-			command->draw(this, draw_list);
+			if (changed)
+			{
+				for (auto command : m_commands)
+					command->draw(this, draw_list);
+			}
+			else
+				drawCache();
+		}
+
+		else
+		{
+			collectVisible();
+			s_stats.submitted += (int)m_visible.size();
+			s_stats.culled += (int)(m_commands.size() - m_visible.size());
+
+			if (changed)
+			{
+				for (auto command : m_visible)
+					command->draw(this, draw_list);
+			}
+			else
+				drawCacheVisible();
+		}
+
+		m_visibleMin = { -FLT_MAX, -FLT_MAX };
+		m_visibleMax = { FLT_MAX, FLT_MAX };
 
 		ImGui::PopClipRect();
 		ImGui::Dummy(ImVec2((float)m_width, (float)m_height));
 
 	}
 
+	mvDrawingStats mvDrawing::GetStats()
+	{
+		int frame = ImGui::GetFrameCount();
+		if (s_statsFrame == frame)
+			return s_lastStats;
+		if (s_statsFrame == frame - 1)
+			return s_stats;
+		return mvDrawingStats();
+	}
+
+	static std::int64_t CellKey(int x, int y)
+	{
+		return ((std::int64_t)x << 32) | (std::uint32_t)y;
+	}
+
+	// clamped before the cast, far away commands share the outermost cells
+	// and are still tested against their exact bounds
+	static int CellOf(float value, float cellSize)
+	{
+		constexpr float limit = 16777216.0f; // 2^24 cells
+		float cell = std::floor(value / cellSize);
+		if (std::isnan(cell))
+			return 0;
+		return (int)std::min(std::max(cell, -limit), limit);
+	}
+
+	static bool IsFinite(const ImVec2& point)
+	{
+		return std::isfinite(point.x) && std::isfinite(point.y);
+	}
+
+	void mvDrawing::addBounds(mvDrawingCommand* command)
+	{
+		command->bounded = command->getBounds(command->boundsMin, command->boundsMax);
+		command->indexed = true;
+		command->gridded = false;
+
+		// non-finite bounds can't be placed on the grid
+		if (command->bounded && IsFinite(command->boundsMin) && IsFinite(command->boundsMax))
+		{
+			int x0 = CellOf(command->boundsMin.x, s_cellSize);
+			int y0 = CellOf(command->boundsMin.y, s_cellSize);
+			int x1 = CellOf(command->boundsMax.x, s_cellSize);
+			int y1 = CellOf(command->boundsMax.y, s_cellSize);
+
+			// large commands are tested directly instead
+			if ((std::int64_t)(x1 - x0 + 1) * (std::int64_t)(y1 - y0 + 1) <= s_maxCells)
+			{
+				for (int y = y0; y <= y1; y++)
+				{
+					for (int x = x0; x <= x1; x++)
+						m_grid[CellKey(x, y)].push_back(command);
+				}
+				command->gridded = true;
+				return;
+			}
+		}
+
+		m_unbounded.push_back(command);
+	}
+
+	void mvDrawing::removeBounds(mvDrawingCommand* command)
+	{
+		// queued commands are not indexed yet
+		if (!command->indexed)
+			return;
+
+		command->indexed = false;
+
+		if (!command->gridded)
+		{
+			m_unbounded.erase(std::find(m_unbounded.begin(), m_unbounded.end(), command));
+			return;
+		}
+
+		int x0 = CellOf(command->boundsMin.x, s_cellSize);
+		int y0 = CellOf(command->boundsMin.y, s_cellSize);
+		int x1 = CellOf(command->boundsMax.x, s_cellSize);
+		int y1 = CellOf(command->boundsMax.y, s_cellSize);
+
+		for (int y = y0; y <= y1; y++)
+		{
+			for (int x = x0; x <= x1; x++)
+			{
+				auto cell = m_grid.find(CellKey(x, y));
+				cell->second.erase(std::find(cell->second.begin(), cell->second.end(), command));
+				if (cell->second.empty())
+					m_grid.erase(cell);
+			}
+		}
+	}
+
+	void mvDrawing::collectVisible()
+	{
+		m_visible.clear();
+		m_visitStamp++;
+
+		if (m_visibleMax.x <= m_visibleMin.x || m_visibleMax.y <= m_visibleMin.y)
+			return;
+
+		for (auto command : m_unbounded)
+		{
+			if (!command->bounded || isVisible(command->boundsMin, command->boundsMax))
+				m_visible.push_back(command);
+		}
+
+		int x0 = CellOf(m_visibleMin.x, s_cellSize);
+		int y0 = CellOf(m_visibleMin.y, s_cellSize);
+		int x1 = CellOf(m_visibleMax.x, s_cellSize);
+		int y1 = CellOf(m_visibleMax.y, s_cellSize);
+
+		for (int y = y0; y <= y1; y++)
+		{
+			for (int x = x0; x <= x1; x++)
+			{
+				auto cell = m_grid.find(CellKey(x, y));
+				if (cell == m_grid.end())
+					continue;
+
+				// commands spanning several cells are collected once
+				for (auto command : cell->second)
+				{
+					if (command->visited == m_visitStamp)
+						continue;
+					command->visited = m_visitStamp;
+
+					if (isVisible(command->boundsMin, command->boundsMax))
+						m_visible.push_back(command);
+				}
+			}
+		}
+
+		// keep the drawing order
+		std::sort(m_visible.begin(), m_visible.end(),
+			[](const mvDrawingCommand* a, const mvDrawingCommand* b) { return a->index < b->index; });
+	}
+
+	void mvDrawing::buildCache()
+	{
+		MV_PROFILE_SCOPE("drawing cache");
+
+		m_vertices.clear();
+		m_indices.clear();
+		m_segments.clear();
+		m_recorded.clear();
+		m_recorded.reserve(m_commands.size());
+
+		// vertex offsets are disabled so every index can be recovered
+		// from the vertex count before the command was recorded
+		ImDrawList recorder(ImGui::GetDrawListSharedData());
+		recorder.Flags = draw_list->Flags & ~ImDrawListFlags_AllowVtxOffset;
+		recorder.AddDrawCmd();
+		// text is culled against the clip rect while recording, so it must
+		// cover any coordinate. The replayed geometry is clipped by the canvas.
+		recorder.PushClipRect(ImVec2(-FLT_MAX, -FLT_MAX), ImVec2(FLT_MAX, FLT_MAX));
+		recorder.PushTextureID(ImGui::GetIO().Fonts->TexID);
+
+		// recorded relative to the canvas
+		float startx = m_startx;
+		float starty = m_starty;
+		m_startx = 0.0f;
+		m_starty = 0.0f;
+
+		// a segment is replayed with one reservation so it must be indexable
+		const int maxVertices = sizeof(ImDrawIdx) == 2 ? 0xFFFF : 0x7FFFFFFF;
+
+		Segment segment;
+
+		// commands that are not cached are drawn directly in between segments
+		auto addDirect = [&](mvDrawingCommand* command)
+		{
+			if (segment.idxCount > 0)
+				m_segments.push_back(segment);
+
+			Segment direct;
+			direct.command = command;
+			m_segments.push_back(direct);
+			m_recorded.push_back(direct);
+
+			segment = Segment();
+			segment.vtxStart = recorder.VtxBuffer.Size;
+			segment.idxStart = (int)m_indices.size();
+		};
+
+		for (auto command : m_commands)
+		{
+			if (command->getType() == mvDrawingCommandType::DrawImage)
+			{
+				addDirect(command);
+				continue;
+			}
+
+			Segment recorded;
+			recorded.vtxStart = recorder.VtxBuffer.Size;
+			recorded.idxStart = recorder.IdxBuffer.Size;
+			command->draw(this, &recorder);
+			recorded.vtxCount = recorder.VtxBuffer.Size - recorded.vtxStart;
+			recorded.idxCount = recorder.IdxBuffer.Size - recorded.idxStart;
+
+			// a single command past the index range wraps its own indices (large
+			// polygons and batches), it is dropped from the recording
+			if (recorded.vtxCount > maxVertices)
+			{
+				recorder.VtxBuffer.shrink(recorded.vtxStart);
+				recorder.IdxBuffer.shrink(recorded.idxStart);
+				recorder.CmdBuffer.back().ElemCount -= recorded.idxCount;
+				recorder._VtxWritePtr = recorder.VtxBuffer.Data + recorded.vtxStart;
+				recorder._IdxWritePtr = recorder.IdxBuffer.Data + recorded.idxStart;
+				recorder._VtxCurrentIdx = (unsigned)recorded.vtxStart;
+				addDirect(command);
+				continue;
+			}
+
+			m_recorded.push_back(recorded);
+
+			if (segment.vtxCount > 0 && segment.vtxCount + recorded.vtxCount > maxVertices)
+			{
+				m_segments.push_back(segment);
+				segment = Segment();
+				segment.vtxStart = recorded.vtxStart;
+				segment.idxStart = recorded.idxStart;
+			}
+
+			// undo the 16 bit wrap around
+			for (int i = recorded.idxStart; i < recorder.IdxBuffer.Size; i++)
+				m_indices.push_back((unsigned)(recorded.vtxStart + (int)(ImDrawIdx)(recorder.IdxBuffer[i] - (ImDrawIdx)recorded.vtxStart)));
+
+			segment.vtxCount += recorded.vtxCount;
+			segment.idxCount += recorded.idxCount;
+		}
+
+		if (segment.idxCount > 0)
+			m_segments.push_back(segment);
+
+		m_vertices.assign(recorder.VtxBuffer.begin(), recorder.VtxBuffer.end());
+
+		m_startx = startx;
+		m_starty = starty;
+		m_cacheValid = true;
+	}
+
+	void mvDrawing::replayCache(int vtxStart, int vtxCount, int idxStart, int idxCount)
+	{
+		if (idxCount == 0)
+			return;
+
+		draw_list->PrimReserve(idxCount, vtxCount);
+
+		ImDrawVert* vtx = draw_list->_VtxWritePtr;
+		const ImDrawVert* cached = m_vertices.data() + vtxStart;
+		for (int i = 0; i < vtxCount; i++)
+		{
+			vtx[i] = cached[i];
+			vtx[i].pos.x += m_startx;
+			vtx[i].pos.y += m_starty;
+		}
+
+		ImDrawIdx* idx = draw_list->_IdxWritePtr;
+		const unsigned* indices = m_indices.data() + idxStart;
+		unsigned base = draw_list->_VtxCurrentIdx - (unsigned)vtxStart;
+		for (int i = 0; i < idxCount; i++)
+			idx[i] = (ImDrawIdx)(base + indices[i]);
+
+		draw_list->_VtxWritePtr += vtxCount;
+		draw_list->_IdxWritePtr += idxCount;
+		draw_list->_VtxCurrentIdx += vtxCount;
+	}
+
+	void mvDrawing::drawCache()
+	{
+		for (const auto& segment : m_segments)
+		{
+			if (segment.command)
+				segment.command->draw(this, draw_list);
+			else
+				replayCache(segment.vtxStart, segment.vtxCount, segment.idxStart, segment.idxCount);
+		}
+	}
+
+	void mvDrawing::drawCacheVisible()
+	{
+		const int maxVertices = sizeof(ImDrawIdx) == 2 ? 0xFFFF : 0x7FFFFFFF;
+
+		size_t i = 0;
+		while (i < m_visible.size())
+		{
+			const Segment& first = m_recorded[m_visible[i]->index];
+			if (first.command)
+			{
+				first.command->draw(this, draw_list);
+				i++;
+				continue;
+			}
+
+			// commands recorded next to each other are replayed together
+			int vtxEnd = first.vtxStart + first.vtxCount;
+			int idxEnd = first.idxStart + first.idxCount;
+			size_t next = i + 1;
+			for (; next < m_visible.size(); next++)
+			{
+				const Segment& recorded = m_recorded[m_visible[next]->index];
+				if (recorded.command || recorded.vtxStart != vtxEnd || recorded.idxStart != idxEnd ||
+					recorded.vtxStart + recorded.vtxCount - first.vtxStart > maxVertices)
+					break;
+
+				vtxEnd += recorded.vtxCount;
+				idxEnd += recorded.idxCount;
+			}
+
+			replayCache(first.vtxStart, vtxEnd - first.vtxStart, first.idxStart, idxEnd - first.idxStart);
+			i = next;
+		}
+	}
+
 	void mvDrawing::clear()
 	{
 		for (mvDrawingCommand* item : m_commands)
@@ -229,6 +750,11 @@ namespace Marvel {
 		}
 
 		m_commands.clear();
+		m_tags.clear();
+		m_queued.clear();
+		m_grid.clear();
+		m_unbounded.clear();
+		m_dirty = true;
 	}
 
 	mvVec2 mvDrawing::convertToModelSpace(const mvVec2& point)
@@ -245,31 +771,22 @@ namespace Marvel {
 		}
 	}
 
-	void mvDrawing::drawLine(const mvVec2& p1, const mvVec2& p2, const mvColor& color, float thickness, const std::string& tag)
+	void mvDrawing::convertToModelSpace(std::vector<float>& points, const std::vector<float>& pointso)
 	{
-		m_dirty = true;
-
-		if (!tag.empty())
+		for (size_t i = 0; i + 1 < points.size(); i += 2)
 		{
-			for (auto item : m_commands)
-			{
-				if (item->tag == tag && item->getType() == mvDrawingCommandType::DrawLine)
-				{
-					*(mvDrawLineCommand*)(item) = mvDrawLineCommand(p1, p2, color, thickness);
-					item->tag = tag;
-					return;
-				}
-			}
+			points[i] = pointso[i] * m_scalex + m_originx;
+			points[i + 1] = (float)m_height - pointso[i + 1] * m_scaley - m_originy;
 		}
+	}
 
-		mvDrawingCommand* command = new mvDrawLineCommand(p1, p2,  color, thickness);
-		command->tag = tag;
-		m_commands.push_back(command);
+	void mvDrawing::drawLine(const mvVec2& p1, const mvVec2& p2, const mvColor& color, float thickness, const std::string& tag)
+	{
+		addCommand<mvDrawLineCommand>(tag, p1, p2, color, thickness);
 	}
 
 	void mvDrawing::drawArrow(const mvVec2& p1, const mvVec2& p2, const mvColor& color, float thickness, float size, const std::string& tag)
 	{
-		m_dirty = true;
 		float xsi = p1.x;
 		float xfi = p2.x;
 		float ysi = p1.y;
@@ -303,335 +820,273 @@ namespace Marvel {
 		points.push_back({ (float)(x1 - 0.5 * size * sin(angle)), (float)(y1 + 0.5 * size * cos(angle)) });
 		points.push_back({ (float)(x1 + 0.5 * size * cos((M_PI / 2.0) - angle)), (float)(y1 - 0.5 * size * sin((M_PI / 2.0) - angle) )});
 
-		if (!tag.empty())
-		{
-			for (auto item : m_commands)
-			{
-				if (item->tag == tag && item->getType() == mvDrawingCommandType::DrawArrow)
-				{
-					*(mvDrawArrowCommand*)(item) = mvDrawArrowCommand(p1, p2, points, color, thickness, size);
-					item->tag = tag;
-					m_dirty = true;
-					return;
-				}
-			}
-		}
-
+		addCommand<mvDrawArrowCommand>(tag, p1, p2, points, color, thickness, size);
+	}
 
+	void mvDrawing::drawTriangle(const mvVec2& p1, const mvVec2& p2, const mvVec2& p3, const mvColor& color, const mvColor& fill, float thickness, const std::string& tag)
+	{
+		addCommand<mvDrawTriangleCommand>(tag, p1, p2, p3, color, thickness, fill);
+	}
 
+	void mvDrawing::drawRectangle(const mvVec2& pmin, const mvVec2& pmax, const mvColor& color, const mvColor& fill, float rounding, float thickness, const std::string& tag)
+	{
+		addCommand<mvDrawRectCommand>(tag, pmin, pmax, color, fill, rounding, thickness);
+	}
 
-		mvDrawingCommand* command = new mvDrawArrowCommand(p1, p2, points, color, thickness, size);
-		command->tag = tag;
-		m_commands.push_back(command);
+	void mvDrawing::drawQuad(const mvVec2& p1, const mvVec2& p2, const mvVec2& p3, const mvVec2& p4, const mvColor& color, const mvColor& fill, float thickness, const std::string& tag)
+	{
+		addCommand<mvDrawQuadCommand>(tag, p1, p2, p3, p4, color, fill, thickness);
 	}
 
-	void mvDrawing::drawTriangle(const mvVec2& p1, const mvVec2& p2, const mvVec2& p3, const mvColor& color, const mvColor& fill, float thickness, const std::string& tag)
+	void mvDrawing::drawText(const mvVec2& pos, const std::string& text, const mvColor& color, int size, const std::string& tag)
 	{
-		m_dirty = true;
-		if (!tag.empty())
-		{
-			for (auto item : m_commands)
-			{
-				if (item->tag == tag && item->getType() == mvDrawingCommandType::DrawTriangle)
-				{
-					*(mvDrawTriangleCommand*)(item) = mvDrawTriangleCommand(p1,
-						p2, p3, color, thickness, fill);
-					item->tag = tag;
-					m_dirty = true;
-					return;
-				}
-			}
-		}
+		addCommand<mvDrawTextCommand>(tag, pos, text, color, size);
+	}
 
-		mvDrawingCommand* command = new mvDrawTriangleCommand(p1,
-			p2, p3, color, thickness, fill);
-		command->tag = tag;
-		m_commands.push_back(command);
+	void mvDrawing::drawCircle(const mvVec2& center, float radius, const mvColor& color, int segments, float thickness, const mvColor& fill, const std::string& tag)
+	{
+		addCommand<mvDrawCircleCommand>(tag, center, radius, color, segments, thickness, fill);
 	}
 
-	void mvDrawing::drawRectangle(const mvVec2& pmin, const mvVec2& pmax, const mvColor& color, const mvColor& fill, float rounding, float thickness, const std::string& tag)
+	void mvDrawing::drawPolyline(std::vector<mvVec2>& points, const mvColor& color, bool closed, float thickness, const std::string& tag)
 	{
-		m_dirty = true;
-		if (!tag.empty())
-		{
-			for (auto item : m_commands)
-			{
-				if (item->tag == tag && item->getType() == mvDrawingCommandType::DrawRect)
-				{
-					*(mvDrawRectCommand*)(item) = mvDrawRectCommand(pmin, pmax, color, fill, rounding, thickness);
-					item->tag = tag;
-					m_dirty = true;
-					return;
-				}
-			}
-		}
+		addCommand<mvDrawPolylineCommand>(tag, points, color, closed, thickness);
+	}
 
-		mvDrawingCommand* command = new mvDrawRectCommand(pmin, pmax, color, fill, rounding, thickness);
-		command->tag = tag;
-		m_commands.push_back(command);
+	void mvDrawing::drawPolygon(std::vector<mvVec2>& points, const mvColor& color, const mvColor& fill, float thickness, const std::string& tag)
+	{
+		addCommand<mvDrawPolygonCommand>(tag, points, color, fill, thickness);
 	}
 
-	void mvDrawing::drawQuad(const mvVec2& p1, const mvVec2& p2, const mvVec2& p3, const mvVec2& p4, const mvColor& color, const mvColor& fill, float thickness, const std::string& tag)
+	void mvDrawing::drawBezierCurve(const mvVec2& p1, const mvVec2& p2, const mvVec2& p3, const mvVec2& p4, const mvColor& color, float thickness, int segments, const std::string& tag)
 	{
-		m_dirty = true;
-		if (!tag.empty())
-		{
-			for (auto item : m_commands)
-			{
-				if (item->tag == tag && item->getType() == mvDrawingCommandType::DrawQuad)
-				{
-					*(mvDrawQuadCommand*)(item) = mvDrawQuadCommand(p1, p2,
-						p3, p4, color, fill, thickness);
-					item->tag = tag;
-					m_dirty = true;
-					return;
-				}
-			}
-		}
+		addCommand<mvDrawBezierCurveCommand>(tag, p1, p2, p3, p4, color, thickness, segments);
+	}
 
-		mvDrawingCommand* command = new mvDrawQuadCommand(p1, p2,
-			p3, p4, color, fill, thickness);
-		command->tag = tag;
-		m_commands.push_back(command);
+	void mvDrawing::drawImage(const std::string& file, const mvVec2& pmin, const mvVec2& pmax, const mvVec2& uv_min, const mvVec2& uv_max, const mvColor& color, const std::string& tag)
+	{
+		addCommand<mvDrawImageCommand>(tag, file, pmin, pmax, uv_min, uv_max, color);
 	}
 
-	void mvDrawing::drawText(const mvVec2& pos, const std::string& text, const mvColor& color, int size, const std::string& tag)
+	void mvDrawing::queueCommand(size_t index)
 	{
-		m_dirty = true;
-		if (!tag.empty())
-		{
-			for (auto item : m_commands)
-			{
-				if (item->tag == tag && item->getType() == mvDrawingCommandType::DrawText)
-				{
-					*(mvDrawTextCommand*)(item) = mvDrawTextCommand(pos, text, color, size);
-					item->tag = tag;
-					m_dirty = true;
-					return;
-				}
-			}
-		}
+		mvDrawingCommand* command = m_commands[index];
+		if (command->queued)
+			return;
 
-		mvDrawingCommand* command = new mvDrawTextCommand(pos, text, color, size);
-		command->tag = tag;
-		m_commands.push_back(command);
+		command->queued = true;
+		m_queued.push_back(index);
 	}
 
-	void mvDrawing::drawCircle(const mvVec2& center, float radius, const mvColor& color, int segments, float thickness, const mvColor& fill, const std::string& tag)
+	void mvDrawing::drawCircles(std::vector<float> centers, std::vector<float> radii, std::vector<ImU32> colors, std::vector<ImU32> fills, int segments, float thickness, const std::string& tag)
 	{
-		m_dirty = true;
-		if (!tag.empty())
-		{
-			for (auto item : m_commands)
-			{
-				if (item->tag == tag && item->getType() == mvDrawingCommandType::DrawCircle)
-				{
-					*(mvDrawCircleCommand*)(item) = mvDrawCircleCommand(center, radius, color, segments, thickness, fill);
-					item->tag = tag;
-					m_dirty = true;
-					return;
-				}
-			}
-		}
+		addCommand<mvDrawCirclesCommand>(tag, std::move(centers), std::move(radii), std::move(colors), std::move(fills), segments, thickness);
+	}
 
-		mvDrawingCommand* command = new mvDrawCircleCommand(center, radius, color, segments, thickness, fill);
-		command->tag = tag;
-		m_commands.push_back(command);
+	void mvDrawing::drawLines(std::vector<float> points, std::vector<ImU32> colors, float thickness, const std::string& tag)
+	{
+		addCommand<mvDrawLinesCommand>(tag, std::move(points), std::move(colors), thickness);
 	}
 
-	void mvDrawing::drawPolyline(std::vector<mvVec2>& points, const mvColor& color, bool closed, float thickness, const std::string& tag)
+	void mvDrawing::drawRectangles(std::vector<float> points, std::vector<ImU32> colors, std::vector<ImU32> fills, float rounding, float thickness, const std::string& tag)
 	{
-		m_dirty = true;
+		addCommand<mvDrawRectsCommand>(tag, std::move(points), std::move(colors), std::move(fills), rounding, thickness);
+	}
 
-		if (!tag.empty())
+	bool mvDrawing::deleteCommand(const std::string& tag)
+	{
+		auto found = m_tags.find(tag);
+		if (found == m_tags.end())
+			return false;
+
+		size_t index = found->second;
+		removeBounds(m_commands[index]);
+		delete m_commands[index];
+		m_commands.erase(m_commands.begin() + index);
+		m_tags.erase(found);
+
+		for (size_t i = index; i < m_commands.size(); i++)
+			m_commands[i]->index = i;
+
+		// later commands moved down by one
+		for (auto& item : m_tags)
 		{
-			for (auto item : m_commands)
-			{
-				if (item->tag == tag && item->getType() == mvDrawingCommandType::DrawPolyline)
-				{
-					*(mvDrawPolylineCommand*)(item) = mvDrawPolylineCommand(points, color, closed, thickness);
-					item->tag = tag;
-					m_dirty = true;
-					return;
-				}
-			}
+			if (item.second > index)
+				item.second--;
 		}
 
-		mvDrawingCommand* command = new mvDrawPolylineCommand(points, color, closed, thickness);
-		command->tag = tag;
-		m_commands.push_back(command);
-	}
+		m_queued.erase(std::remove(m_queued.begin(), m_queued.end(), index), m_queued.end());
+		for (auto& queued : m_queued)
+		{
+			if (queued > index)
+				queued--;
+		}
 
-	void mvDrawing::drawPolygon(std::vector<mvVec2>& points, const mvColor& color, const mvColor& fill, float thickness, const std::string& tag)
-	{
 		m_dirty = true;
+		return true;
+	}
 
-		if (!tag.empty())
+	void mvDrawing::updateCommands()
+	{
+		// a new transform (or canvas height) applies to every command,
+		// otherwise only the commands added or replaced are converted
+		if (m_transformChanged || m_transformHeight != m_height)
 		{
-			for (auto item : m_commands)
+			m_grid.clear();
+			m_unbounded.clear();
+
+			for (auto command : m_commands)
 			{
-				if (item->tag == tag && item->getType() == mvDrawingCommandType::DrawPolygon)
-				{
-					*(mvDrawPolygonCommand*)(item) = mvDrawPolygonCommand(points, color, fill, thickness);
-					item->tag = tag;
-					m_dirty = true;
-					return;
-				}
+				transformCommand(command);
+				command->queued = false;
+				command->indexed = false;
+				addBounds(command);
 			}
+			m_transformChanged = false;
+			m_transformHeight = m_height;
 		}
 
-		mvDrawingCommand* command = new mvDrawPolygonCommand(points, color, fill, thickness);
-		command->tag = tag;
-		m_commands.push_back(command);
-	}
-
-	void mvDrawing::drawBezierCurve(const mvVec2& p1, const mvVec2& p2, const mvVec2& p3, const mvVec2& p4, const mvColor& color, float thickness, int segments, const std::string& tag)
-	{
-		m_dirty = true;
-		if (!tag.empty())
+		else
 		{
-			for (auto item : m_commands)
+			for (size_t index : m_queued)
 			{
-				if (item->tag == tag && item->getType() == mvDrawingCommandType::DrawBezierCurve)
-				{
-					*(mvDrawBezierCurveCommand*)(item) = mvDrawBezierCurveCommand(p1, p2, p3,
-						p4, color, thickness, segments);
-					item->tag = tag;
-					m_dirty = true;
-					return;
-				}
+				mvDrawingCommand* command = m_commands[index];
+				removeBounds(command);
+				transformCommand(command);
+				command->queued = false;
+				addBounds(command);
 			}
 		}
 
-		mvDrawingCommand* command = new mvDrawBezierCurveCommand(p1, p2, p3,
-			p4, color, thickness, segments);
-		command->tag = tag;
-		m_commands.push_back(command);
+		m_queued.clear();
+		m_dirty = false;
 	}
 
-	void mvDrawing::drawImage(const std::string& file, const mvVec2& pmin, const mvVec2& pmax, const mvVec2& uv_min, const mvVec2& uv_max, const mvColor& color, const std::string& tag)
+	void mvDrawing::transformCommand(mvDrawingCommand* command)
 	{
-		m_dirty = true;
-		if (!tag.empty())
+		switch (command->getType())
 		{
-			for (auto item : m_commands)
-			{
-				if (item->tag == tag && item->getType() == mvDrawingCommandType::DrawImage)
-				{
-					*(mvDrawImageCommand*)(item) = mvDrawImageCommand(file, pmin, pmax, uv_min, uv_max, color);
-					item->tag = tag;
-					m_dirty = true;
-					return;
-				}
-			}
+
+		case mvDrawingCommandType::DrawImage:
+		{
+			// TODO: figure out how to handle this
+			break;
 		}
 
-		mvDrawingCommand* command = new mvDrawImageCommand(file, pmin, pmax, uv_min, uv_max, color);
-		command->tag = tag;
-		m_commands.push_back(command);
-	}
+		case mvDrawingCommandType::DrawLine:
+		{
+			mvDrawLineCommand& acommand = *(mvDrawLineCommand*)(command);
+			acommand.m_p1 = convertToModelSpace(acommand.m_p1o);
+			acommand.m_p2 = convertToModelSpace(acommand.m_p2o);
+			break;
+		}
 
-	void mvDrawing::updateCommands()
-	{
-		for (auto command : m_commands)
+		case mvDrawingCommandType::DrawArrow:
 		{
-			switch (command->getType())
-			{
+			mvDrawArrowCommand& acommand = *(mvDrawArrowCommand*)(command);
+			acommand.m_p1 = convertToModelSpace(acommand.m_p1o);
+			acommand.m_p2 = convertToModelSpace(acommand.m_p2o);
+			convertToModelSpace(acommand.m_points, acommand.m_pointso);
+			break;
+		}
 
-			case mvDrawingCommandType::DrawImage:
-			{
-				// TODO: figure out how to handle this
-				break;
-			}
+		case mvDrawingCommandType::DrawTriangle:
+		{
+			mvDrawTriangleCommand& acommand = *(mvDrawTriangleCommand*)(command);
+			acommand.m_p1 = convertToModelSpace(acommand.m_p1o);
+			acommand.m_p2 = convertToModelSpace(acommand.m_p2o);
+			acommand.m_p3 = convertToModelSpace(acommand.m_p3o);
+			break;
+		}
 
-			case mvDrawingCommandType::DrawLine:
-			{
-				mvDrawLineCommand& acommand = *(mvDrawLineCommand*)(command);
-				acommand.m_p1 = convertToModelSpace(acommand.m_p1o);
-				acommand.m_p2 = convertToModelSpace(acommand.m_p2o);
-				break;
-			}
+		case mvDrawingCommandType::DrawCircle:
+		{
+			mvDrawCircleCommand& acommand = *(mvDrawCircleCommand*)(command);
+			acommand.m_center = convertToModelSpace(acommand.m_centero);
+			acommand.m_radius = acommand.m_radiuso * m_scalex;
+			break;
+		}
 
-			case mvDrawingCommandType::DrawArrow:
-			{
-				mvDrawArrowCommand& acommand = *(mvDrawArrowCommand*)(command);
-				acommand.m_p1 = convertToModelSpace(acommand.m_p1o);
-				acommand.m_p2 = convertToModelSpace(acommand.m_p2o);
-				convertToModelSpace(acommand.m_points, acommand.m_pointso);
-				break;
-			}
 
-			case mvDrawingCommandType::DrawTriangle:
-			{
-				mvDrawTriangleCommand& acommand = *(mvDrawTriangleCommand*)(command);
-				acommand.m_p1 = convertToModelSpace(acommand.m_p1o);
-				acommand.m_p2 = convertToModelSpace(acommand.m_p2o);
-				acommand.m_p3 = convertToModelSpace(acommand.m_p3o);
-				break;
-			}
+		case mvDrawingCommandType::DrawText:
+		{
+			mvDrawTextCommand& acommand = *(mvDrawTextCommand*)(command);
+			acommand.m_pos = convertToModelSpace(acommand.m_poso);
+			break;
+		}
 
-			case mvDrawingCommandType::DrawCircle:
-			{
-				mvDrawCircleCommand& acommand = *(mvDrawCircleCommand*)(command);
-				acommand.m_center = convertToModelSpace(acommand.m_centero);
-				acommand.m_radius = acommand.m_radiuso * m_scalex;
-				break;
-			}
+		case mvDrawingCommandType::DrawRect:
+		{
+			mvDrawRectCommand& acommand = *(mvDrawRectCommand*)(command);
+			acommand.m_pmin = convertToModelSpace(acommand.m_pmino);
+			acommand.m_pmax = convertToModelSpace(acommand.m_pmaxo);
+			break;
+		}
 
+		case mvDrawingCommandType::DrawQuad:
+		{
+			mvDrawQuadCommand& acommand = *(mvDrawQuadCommand*)(command);
+			acommand.m_p1 = convertToModelSpace(acommand.m_p1o);
+			acommand.m_p2 = convertToModelSpace(acommand.m_p2o);
+			acommand.m_p3 = convertToModelSpace(acommand.m_p3o);
+			acommand.m_p4 = convertToModelSpace(acommand.m_p4o);
+			break;
+		}
 
-			case mvDrawingCommandType::DrawText:
-			{
-				mvDrawTextCommand& acommand = *(mvDrawTextCommand*)(command);
-				acommand.m_pos = convertToModelSpace(acommand.m_poso);
-				break;
-			}
+		case mvDrawingCommandType::DrawPolyline:
+		{
+			mvDrawPolylineCommand& acommand = *(mvDrawPolylineCommand*)(command);
+			convertToModelSpace(acommand.m_points, acommand.m_pointso);
+			break;
+		}
 
-			case mvDrawingCommandType::DrawRect:
-			{
-				mvDrawRectCommand& acommand = *(mvDrawRectCommand*)(command);
-				acommand.m_pmin = convertToModelSpace(acommand.m_pmino);
-				acommand.m_pmax = convertToModelSpace(acommand.m_pmaxo);
-				break;
-			}
+		case mvDrawingCommandType::DrawPolygon:
+		{
+			mvDrawPolygonCommand& acommand = *(mvDrawPolygonCommand*)(command);
+			convertToModelSpace(acommand.m_points, acommand.m_pointso);
 
-			case mvDrawingCommandType::DrawQuad:
+			if (acommand.m_fill.specified)
 			{
-				mvDrawQuadCommand& acommand = *(mvDrawQuadCommand*)(command);
-				acommand.m_p1 = convertToModelSpace(acommand.m_p1o);
-				acommand.m_p2 = convertToModelSpace(acommand.m_p2o);
-				acommand.m_p3 = convertToModelSpace(acommand.m_p3o);
-				acommand.m_p4 = convertToModelSpace(acommand.m_p4o);
-				break;
+				acommand.m_fillPoints.assign((const ImVec2*)acommand.m_points.data(), (const ImVec2*)acommand.m_points.data() + acommand.m_points.size());
+				TriangulatePolygon(acommand.m_fillPoints, acommand.m_fillIndices);
 			}
+			break;
+		}
 
-			case mvDrawingCommandType::DrawPolyline:
-			{
-				mvDrawPolylineCommand& acommand = *(mvDrawPolylineCommand*)(command);
-				convertToModelSpace(acommand.m_points, acommand.m_pointso);
-				break;
-			}
+		case mvDrawingCommandType::DrawBezierCurve:
+		{
+			mvDrawBezierCurveCommand& acommand = *(mvDrawBezierCurveCommand*)(command);
+			acommand.m_p1 = convertToModelSpace(acommand.m_p1o);
+			acommand.m_p2 = convertToModelSpace(acommand.m_p2o);
+			acommand.m_p3 = convertToModelSpace(acommand.m_p3o);
+			acommand.m_p4 = convertToModelSpace(acommand.m_p4o);
+			break;
+		}
 
-			case mvDrawingCommandType::DrawPolygon:
-			{
-				mvDrawPolygonCommand& acommand = *(mvDrawPolygonCommand*)(command);
-				convertToModelSpace(acommand.m_points, acommand.m_pointso);
-				break;
-			}
+		case mvDrawingCommandType::DrawCircles:
+		{
+			mvDrawCirclesCommand& acommand = *(mvDrawCirclesCommand*)(command);
+			convertToModelSpace(acommand.m_centers, acommand.m_centerso);
+			for (size_t i = 0; i < acommand.m_radii.size(); i++)
+				acommand.m_radii[i] = acommand.m_radiio[i] * m_scalex;
+			break;
+		}
 
-			case mvDrawingCommandType::DrawBezierCurve:
-			{
-				mvDrawBezierCurveCommand& acommand = *(mvDrawBezierCurveCommand*)(command);
-				acommand.m_p1 = convertToModelSpace(acommand.m_p1o);
-				acommand.m_p2 = convertToModelSpace(acommand.m_p2o);
-				acommand.m_p3 = convertToModelSpace(acommand.m_p3o);
-				acommand.m_p4 = convertToModelSpace(acommand.m_p4o);
-				break;
-			}
+		case mvDrawingCommandType::DrawLines:
+		{
+			mvDrawLinesCommand& acommand = *(mvDrawLinesCommand*)(command);
+			convertToModelSpace(acommand.m_points, acommand.m_pointso);
+			break;
+		}
 
-			}
+		case mvDrawingCommandType::DrawRects:
+		{
+			mvDrawRectsCommand& acommand = *(mvDrawRectsCommand*)(command);
+			convertToModelSpace(acommand.m_points, acommand.m_pointso);
+			break;
 		}
 
-		m_dirty = false;
+		}
 	}
 
 	void mvDrawing::setScale(float xscale, float yscale) 
@@ -639,6 +1094,7 @@ namespace Marvel {
 		m_scalex = xscale; 
 		m_scaley = yscale; 
 		m_dirty = true;
+		m_transformChanged = true;
 	}
 
 	void mvDrawing::setOrigin(float x, float y) 
@@ -646,5 +1102,6 @@ namespace Marvel {
 		m_originx = x; 
 		m_originy = y; 
 		m_dirty = true;
+		m_transformChanged = true;
 	}
 }
\ No newline at end of file
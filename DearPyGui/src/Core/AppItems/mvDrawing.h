@@ -1,6 +1,9 @@
 #pragma once
 
 #include <utility>
+#include <unordered_map>
+#include <cstdint>
+#include <cfloat>
 
 #include "Core/AppItems/mvTypeBases.h"
 #include "Core/mvTextureStorage.h"
@@ -13,7 +16,8 @@
 //-----------------------------------------------------------------------------
 
 #define MV_DRAWCOMMAND_TYPE(x) virtual mvDrawingCommandType getType() const override { return x; }\
-virtual void draw(mvDrawing* draw, ImDrawList* draw_list) override;
+virtual void draw(mvDrawing* draw, ImDrawList* draw_list) override;\
+virtual bool getBounds(ImVec2& pmin, ImVec2& pmax) const override;
 
 namespace Marvel {
 
@@ -25,7 +29,8 @@ namespace Marvel {
 	enum class mvDrawingCommandType
 	{
 		DrawLine, DrawTriangle, DrawCircle, DrawText, DrawRect, DrawQuad,
-		DrawPolyline, DrawBezierCurve, DrawPolygon, DrawImage, DrawArrow
+		DrawPolyline, DrawBezierCurve, DrawPolygon, DrawImage, DrawArrow,
+		DrawCircles, DrawLines, DrawRects
 	};
 
 	//-----------------------------------------------------------------------------
@@ -40,7 +45,21 @@ namespace Marvel {
 		virtual void draw(mvDrawing* drawing, ImDrawList* draw_list) = 0;
 		[[nodiscard]] virtual mvDrawingCommandType getType() const = 0;
 
+		// canvas space (after model space conversion), false if the
+		// command has no known bounds and is never culled
+		virtual bool getBounds(ImVec2& pmin, ImVec2& pmax) const = 0;
+
 		std::string tag;
+		bool        queued = false; // waiting in mvDrawing to be converted to model space
+
+		// culling state, maintained by mvDrawing
+		size_t      index = 0;        // position in the drawing
+		ImVec2      boundsMin;
+		ImVec2      boundsMax;
+		bool        bounded = false;  // bounds are known
+		bool        indexed = false;  // in the grid or the unbounded list
+		bool        gridded = false;  // in the grid (otherwise the unbounded list)
+		unsigned    visited = 0;      // last culling pass that collected the command
 
 	};
 
@@ -63,6 +82,9 @@ namespace Marvel {
 				m_autosize = true;
 		}
 
+		mvDrawImageCommand(const mvDrawImageCommand&) = delete;
+		mvDrawImageCommand& operator=(const mvDrawImageCommand&) = delete;
+
 		~mvDrawImageCommand() override;
 
 	private:
@@ -79,6 +101,7 @@ namespace Marvel {
 		int         m_width = 0;
 		int         m_height = 0;
 		bool        m_autosize = false;
+		bool        m_added = false; // holds a reference to the texture
 
 	};
 
@@ -331,6 +354,9 @@ namespace Marvel {
 		mvColor             m_fill;
 		float               m_thickness;
 
+		// fill triangulated once per geometry change (model space)
+		std::vector<ImVec2>   m_fillPoints;
+		std::vector<unsigned> m_fillIndices;
 
 	};
 
@@ -364,8 +390,115 @@ namespace Marvel {
 		int     m_segments;
 	};
 
+	//-----------------------------------------------------------------------------
+	// Batch Commands
+	//     - Many primitives stored as one command, one array per attribute.
+	//       Points are packed (x, y, ...). Colors hold either one color for
+	//       all primitives or one per primitive.
+	//-----------------------------------------------------------------------------
+
+	//-----------------------------------------------------------------------------
+	// mvDrawCirclesCommand
+	//     - Batches are single commands, so only batches small enough for one
+	//       cache reservation (about 65k vertices with 16 bit indices) are
+	//       replayed from the drawing cache. Larger ones are drawn directly
+	//       every frame.
+	//-----------------------------------------------------------------------------
+	class mvDrawCirclesCommand : public mvDrawingCommand
+	{
+
+	public:
+
+		MV_DRAWCOMMAND_TYPE(mvDrawingCommandType::DrawCircles)
+
+		mvDrawCirclesCommand(std::vector<float> centers, std::vector<float> radii, std::vector<ImU32> colors,
+				std::vector<ImU32> fills, int segments, float thickness)
+			: mvDrawingCommand(), m_centers(centers), m_radii(radii), m_centerso(std::move(centers)), m_radiio(std::move(radii)),
+			m_colors(std::move(colors)), m_fills(std::move(fills)), m_segments(segments), m_thickness(thickness)
+		{
+		}
+
+	public:
+
+		std::vector<float> m_centers;
+		std::vector<float> m_radii;    // one for all or one per circle
+		std::vector<float> m_centerso; // original, no scaling
+		std::vector<float> m_radiio;   // original, no scaling
+		std::vector<ImU32> m_colors;
+		std::vector<ImU32> m_fills;    // empty if not filled
+		int                m_segments;
+		float              m_thickness;
+
+	};
+
+	//-----------------------------------------------------------------------------
+	// mvDrawLinesCommand
+	//     - points are packed as (x1, y1, x2, y2) per line
+	//-----------------------------------------------------------------------------
+	class mvDrawLinesCommand : public mvDrawingCommand
+	{
+
+	public:
+
+		MV_DRAWCOMMAND_TYPE(mvDrawingCommandType::DrawLines)
+
+		mvDrawLinesCommand(std::vector<float> points, std::vector<ImU32> colors, float thickness)
+			: mvDrawingCommand(), m_points(points), m_pointso(std::move(points)), m_colors(std::move(colors)), m_thickness(thickness)
+		{
+		}
+
+	public:
+
+		std::vector<float> m_points;
+		std::vector<float> m_pointso; // original, no scaling
+		std::vector<ImU32> m_colors;
+		float              m_thickness;
+
+	};
+
+	//-----------------------------------------------------------------------------
+	// mvDrawRectsCommand
+	//     - points are packed as (xmin, ymin, xmax, ymax) per rectangle
+	//-----------------------------------------------------------------------------
+	class mvDrawRectsCommand : public mvDrawingCommand
+	{
+
+	public:
+
+		MV_DRAWCOMMAND_TYPE(mvDrawingCommandType::DrawRects)
+
+		mvDrawRectsCommand(std::vector<float> points, std::vector<ImU32> colors, std::vector<ImU32> fills, float rounding, float thickness)
+			: mvDrawingCommand(), m_points(points), m_pointso(std::move(points)), m_colors(std::move(colors)), m_fills(std::move(fills)),
+			m_rounding(rounding), m_thickness(thickness)
+		{
+		}
+
+	public:
+
+		std::vector<float> m_points;
+		std::vector<float> m_pointso; // original, no scaling
+		std::vector<ImU32> m_colors;
+		std::vector<ImU32> m_fills;   // empty if not filled
+		float              m_rounding;
+		float              m_thickness;
+
+	};
+
+	//-----------------------------------------------------------------------------
+	// mvDrawingStats
+	//-----------------------------------------------------------------------------
+	struct mvDrawingStats
+	{
+		int drawings = 0;
+		int submitted = 0; // commands drawn
+		int culled = 0;    // commands outside the visible region
+	};
+
 	//-----------------------------------------------------------------------------
 	// mvDrawing
+	//     - Command bounds are kept in a uniform grid (canvas space) so only
+	//       commands intersecting the visible region are drawn when the
+	//       canvas is partly scrolled or clipped out.
 	//-----------------------------------------------------------------------------
 	class mvDrawing : public mvAppItem
 	{
@@ -405,6 +538,14 @@ namespace Marvel {
 		void drawBezierCurve(const mvVec2& p1, const mvVec2& p2, const mvVec2& p3, const mvVec2& p4, const mvColor& color, float thickness, int segments, const std::string& tag = "");
 		void drawImage      (const std::string& file, const mvVec2& pmin, const mvVec2& pmax, const mvVec2& uv_min, const mvVec2& uv_max, const mvColor& color, const std::string& tag = "");
 
+		// packed arrays, see the batch commands above
+		void drawCircles    (std::vector<float> centers, std::vector<float> radii, std::vector<ImU32> colors, std::vector<ImU32> fills, int segments, float thickness, const std::string& tag = "");
+		void drawLines      (std::vector<float> points, std::vector<ImU32> colors, float thickness, const std::string& tag = "");
+		void drawRectangles (std::vector<float> points, std::vector<ImU32> colors, std::vector<ImU32> fills, float rounding, float thickness, const std::string& tag = "");
+
+		// returns false if no command has the tag
+		bool deleteCommand  (const std::string& tag);
+
 		void setScale(float xscale, float yscale);
 		void setOrigin(float x, float y);
 
@@ -413,14 +554,86 @@ namespace Marvel {
 
 		mvVec2 convertToModelSpace(const mvVec2& point);
 		void convertToModelSpace(std::vector<mvVec2>& points, const std::vector<mvVec2>& pointso);
+		void convertToModelSpace(std::vector<float>& points, const std::vector<float>& pointso); // packed
+
+		// reused by commands that offset their points every draw
+		std::vector<mvVec2>& getPointBuffer() { return m_pointBuffer; }
+
+		// canvas space, used by batch commands to skip primitives
+		[[nodiscard]] bool isVisible(const ImVec2& pmin, const ImVec2& pmax) const
+		{
+			return pmax.x >= m_visibleMin.x && pmin.x <= m_visibleMax.x && pmax.y >= m_visibleMin.y && pmin.y <= m_visibleMax.y;
+		}
+
+		// totals of the last complete frame
+		static mvDrawingStats GetStats();
 
 	private:
 
+		//-----------------------------------------------------------------------------
+		// Segment
+		//     - Part of the cache replayed with a single reservation. Images
+		//       (their texture may still be loading) and commands with more
+		//       vertices than a reservation can index are not cached and are
+		//       drawn directly in between.
+		//-----------------------------------------------------------------------------
+		struct Segment
+		{
+			int               vtxStart = 0;
+			int               vtxCount = 0;
+			int               idxStart = 0;
+			int               idxCount = 0;
+			mvDrawingCommand* command = nullptr; // drawn directly if set
+		};
+
 		void updateCommands();
+		void transformCommand(mvDrawingCommand* command);
+		void queueCommand(size_t index);
+		void addBounds(mvDrawingCommand* command);
+		void removeBounds(mvDrawingCommand* command);
+		void collectVisible();
+		void buildCache();
+		void drawCache();
+		void drawCacheVisible();
+		void replayCache(int vtxStart, int vtxCount, int idxStart, int idxCount);
+
+		// tagged commands replace the command with the same tag in place
+		template<typename T, typename ...Args>
+		void addCommand(const std::string& tag, Args&&... args)
+		{
+			m_dirty = true;
+
+			mvDrawingCommand* command = new T(std::forward<Args>(args)...);
+			command->tag = tag;
+
+			if (!tag.empty())
+			{
+				auto found = m_tags.find(tag);
+				if (found != m_tags.end())
+				{
+					mvDrawingCommand*& existing = m_commands[found->second];
+					command->queued = existing->queued;
+					command->index = found->second;
+					removeBounds(existing);
+					delete existing;
+					existing = command;
+					queueCommand(found->second);
+					return;
+				}
+
+				m_tags[tag] = m_commands.size();
+			}
+
+			command->index = m_commands.size();
+			m_commands.push_back(command);
+			queueCommand(command->index);
+		}
 
 	private:
 
 		std::vector<mvDrawingCommand*> m_commands;
+		std::unordered_map<std::string, size_t> m_tags;   // index into m_commands
+		std::vector<size_t>            m_queued;          // commands to convert to model space
 		ImDrawList* draw_list = nullptr;
 		float       m_startx = 0.0f;
 		float       m_starty = 0.0f;
@@ -429,6 +642,32 @@ namespace Marvel {
 		float       m_scalex = 1.0f;
 		float       m_scaley = 1.0f;
 		bool        m_dirty = true;
+		bool        m_transformChanged = false;
+		int         m_transformHeight = 0; // canvas height the commands were converted with
+
+		// commands tessellated relative to the canvas, rebuilt on the first
+		// frame after the commands stop changing
+		std::vector<ImDrawVert> m_vertices;
+		std::vector<unsigned>   m_indices;  // absolute, into m_vertices
+		std::vector<Segment>    m_segments;
+		std::vector<Segment>    m_recorded; // one per command, same order as m_commands
+		std::vector<mvVec2>     m_pointBuffer;
+		bool                    m_cacheValid = false;
+
+		// culling, cells are s_cellSize wide
+		std::unordered_map<std::int64_t, std::vector<mvDrawingCommand*>> m_grid;
+		std::vector<mvDrawingCommand*> m_unbounded; // no bounds or too many cells, always tested
+		std::vector<mvDrawingCommand*> m_visible;   // collected by collectVisible
+		unsigned                       m_visitStamp = 0;
+		ImVec2                         m_visibleMin = { -FLT_MAX, -FLT_MAX };
+		ImVec2                         m_visibleMax = { FLT_MAX, FLT_MAX };
+
+		static constexpr float s_cellSize = 128.0f;
+		static constexpr int   s_maxCells = 256;
+
+		static mvDrawingStats s_stats;
+		static mvDrawingStats s_lastStats;
+		static int            s_statsFrame;
 
 	};
 }
\ No newline at end of file
@@ -32,7 +32,8 @@ namespace Marvel {
 
 		~mvImage() override
 		{
-			mvTextureStorage::DecrementTexture(m_value);
+			if (m_added)
+				mvTextureStorage::DecrementTexture(m_value);
 		}
 
 		void draw() override
@@ -40,22 +41,34 @@ namespace Marvel {
 
 			if (m_texture == nullptr && !m_value.empty())
 			{
-				mvTextureStorage::AddTexture(m_value);
+				// decoded in the background, drawn once uploaded
+				if (!m_added)
+				{
+					mvTextureStorage::AddTexture(m_value);
+					m_added = true;
+				}
+
 				mvTexture* texture = mvTextureStorage::GetTexture(m_value);
-				if(texture == nullptr)
-                {
-                    PyErr_Format(PyExc_Exception,
-                                                "Image %s could not be found for add_image. Check the path to the image "
-                                                "you provided.", m_value.c_str());
-                    PyErr_Print();
-                    m_value = "";
-                    return;
-                }
-				if (m_width == 0) m_width = (int)((float)texture->width*(m_uv_max.x - m_uv_min.x));
-				if (m_height == 0) m_height = (int)((float)texture->height * (m_uv_max.y - m_uv_min.y));
-
-				m_texture = texture->texture;
+				if(texture == nullptr || texture->failed)
+				{
+					mvGlobalIntepreterLock gil;
+					PyErr_Format(PyExc_Exception,
+						"Image %s could not be found for add_image. Check the path to the image "
+						"you provided.", m_value.c_str());
+					PyErr_Print();
+					mvTextureStorage::DecrementTexture(m_value);
+					m_added = false;
+					m_value = "";
+					return;
+				}
+
+				if (texture->texture)
+				{
+					if (m_width == 0) m_width = (int)((float)texture->width * (m_uv_max.x - m_uv_min.x));
+					if (m_height == 0) m_height = (int)((float)texture->height * (m_uv_max.y - m_uv_min.y));
 
+					m_texture = texture->texture;
+				}
 			}
 
 			if(m_texture)
@@ -63,21 +76,41 @@ namespace Marvel {
 					ImVec4((float)m_tintColor.r, (float)m_tintColor.g, (float)m_tintColor.b, (float)m_tintColor.a),
 					ImVec4((float)m_borderColor.r, (float)m_borderColor.g, (float)m_borderColor.b, (float)m_borderColor.a));
 
+			// placeholder while the image is loading
+			else if (!m_value.empty())
+			{
+				ImVec2 size((float)(m_width == 0 ? 100 : m_width), (float)(m_height == 0 ? 100 : m_height));
+				ImVec2 start = ImGui::GetCursorScreenPos();
+				ImGui::Dummy(size);
+				ImGui::GetWindowDrawList()->AddRectFilled(start, ImVec2(start.x + size.x, start.y + size.y),
+					ImGui::GetColorU32(ImGuiCol_FrameBg));
+			}
+
 			// Context Menu
 			if (!getPopup().empty())
 				ImGui::OpenPopup(getPopup().c_str());
 
 		}
 
+		std::string getSecondaryDataSource() const override { return m_secondaryDataSource; }
+
 		void updateData(const std::string& name) override
 		{
 			if (name == m_secondaryDataSource)
 			{
-				PyObject* data = mvDataStorage::GetData(name);
-				if (data == nullptr)
+				const mvDataValue* value = mvDataStorage::GetValue(name);
+				if (value == nullptr)
+					return;
+
+				std::vector<float> floats;
+				if (value->type == mvDataType::FloatList)
+					floats = value->floats;
+				else if (value->type == mvDataType::IntList)
+					floats.assign(value->ints.begin(), value->ints.end());
+
+				if (floats.size() < 4)
 					return;
 
-				auto floats = mvPythonTranslator::ToFloatVect(data);
 				m_uv_min.x = floats[0];
 				m_uv_min.y = floats[1];
 				m_uv_max.x = floats[2];
@@ -108,19 +141,15 @@ namespace Marvel {
 			m_value = PyUnicode_AsUTF8(value);
 			PyGILState_Release(gstate);
 
-			// clean up old resource
-			if (!m_value.empty() && oldvalue != m_value)
-			{
-				mvTextureStorage::DecrementTexture(oldvalue);
-				mvTextureStorage::AddTexture(m_value);
-			}
-
-			m_texture = mvTextureStorage::GetTexture(m_value);
-
-			if (m_texture)
+			// clean up old resource, the new one is loaded by draw
+			if (oldvalue != m_value)
 			{
-				m_width = (int)((float)mvTextureStorage::GetTexture(m_value)->width * (m_uv_max.x - m_uv_min.x));
-				m_height = (int)((float)mvTextureStorage::GetTexture(m_value)->height * (m_uv_max.y - m_uv_min.y));
+				if (m_added)
+					mvTextureStorage::DecrementTexture(oldvalue);
+				m_added = false;
+				m_texture = nullptr;
+				m_width = 0;
+				m_height = 0;
 			}
 		}
 
@@ -146,6 +175,7 @@ namespace Marvel {
 		mvColor     m_borderColor;
 		std::string m_secondaryDataSource;
 		void*       m_texture = nullptr;
+		bool        m_added = false; // holds a reference to the texture
 
 	};
 
@@ -39,7 +39,7 @@ namespace Marvel {
 					if (ImGui::InputTextMultiline(m_label.c_str(), &m_value, ImVec2((float)m_width, (float)m_height)))
 					{
 						if (!m_dataSource.empty())
-							mvDataStorage::AddData(m_dataSource, getPyValue());
+							mvDataStorage::AddData(m_dataSource, getDataValue());
 
 						mvApp::GetApp()->runCallback(m_callback, m_name);
 
@@ -53,7 +53,7 @@ namespace Marvel {
 					if (ImGui::InputText(m_label.c_str(), &m_value, m_flags))
 					{
 						if (!m_dataSource.empty())
-							mvDataStorage::AddData(m_dataSource, getPyValue());
+							mvDataStorage::AddData(m_dataSource, getDataValue());
 
 						mvApp::GetApp()->runCallback(m_callback, m_name);
 
@@ -69,7 +69,7 @@ namespace Marvel {
 				if (ImGui::InputTextWithHint(m_label.c_str(), m_hint.c_str(), &m_value, m_flags))
 				{
 					if (!m_dataSource.empty())
-						mvDataStorage::AddData(m_dataSource, getPyValue());
+						mvDataStorage::AddData(m_dataSource, getDataValue());
 
 					mvApp::GetApp()->runCallback(m_callback, m_name);
 
@@ -1,6 +1,7 @@
 #pragma once
 
 #include "Core/AppItems/mvTypeBases.h"
+#include "Core/mvProfiler.h"
 #include "mvApp.h"
 
 //-----------------------------------------------------------------------------
@@ -50,6 +51,7 @@ namespace Marvel {
 					if (item->getWidth() > 0)
 						ImGui::SetNextItemWidth((float)item->getWidth());
 
+					MV_PROFILE_SCOPE(item->getName());
 					item->draw();
 
 					// Regular Tooltip (simple)
@@ -115,6 +117,7 @@ namespace Marvel {
 					if (item->getWidth() > 0)
 						ImGui::SetNextItemWidth((float)item->getWidth());
 
+					MV_PROFILE_SCOPE(item->getName());
 					item->draw();
 
 					// Regular Tooltip (simple)
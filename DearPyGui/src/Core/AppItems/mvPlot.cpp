@@ -1,94 +1,174 @@
 #include "mvPlot.h"
+#include "Core/mvTriangulator.h"
 
 namespace Marvel {
 
-	void mvAreaSeries::drawPolygon()
+	static constexpr size_t s_lodChunk = 8;        // points per chunk, each chunk becomes 2 points
+	static constexpr size_t s_lodMinPoints = 4096; // series smaller than this are drawn directly
+
+	void mvSeries::buildLevels(size_t first)
 	{
+		if (!m_levels || m_capacity != 0 || !m_sorted)
+		{
+			m_lodXs.clear();
+			m_lodYs.clear();
+			return;
+		}
+
+		size_t level = 0;
+		while ((level == 0 ? m_xs : m_lodXs[level - 1]).size() >= s_lodMinPoints)
+		{
+			// new level, build it completely (added before taking references
+			// since it may reallocate the levels)
+			if (level == m_lodXs.size())
+			{
+				m_lodXs.emplace_back();
+				m_lodYs.emplace_back();
+				first = 0;
+			}
+
+			const std::vector<float>& srcxs = level == 0 ? m_xs : m_lodXs[level - 1];
+			const std::vector<float>& srcys = level == 0 ? m_ys : m_lodYs[level - 1];
+			size_t count = srcxs.size();
+
+			// restart at the chunk containing the first changed point
+			size_t start = (first / s_lodChunk) * s_lodChunk;
+			first = (start / s_lodChunk) * 2;
+
+			std::vector<float>& dstxs = m_lodXs[level];
+			std::vector<float>& dstys = m_lodYs[level];
+			dstxs.resize(first);
+			dstys.resize(first);
+			if (first == 0)
+			{
+				dstxs.reserve(count / s_lodChunk * 2 + 2);
+				dstys.reserve(count / s_lodChunk * 2 + 2);
+			}
+
+			for (size_t i = start; i < count; i += s_lodChunk)
+			{
+				size_t end = std::min(i + s_lodChunk, count);
+				size_t imin = i;
+				size_t imax = i;
+				for (size_t j = i + 1; j < end; j++)
+				{
+					if (srcys[j] < srcys[imin]) imin = j;
+					if (srcys[j] > srcys[imax]) imax = j;
+				}
+
+				// keep index order so x stays sorted
+				size_t a = std::min(imin, imax);
+				size_t b = std::max(imin, imax);
+				dstxs.push_back(srcxs[a]);
+				dstys.push_back(srcys[a]);
+				dstxs.push_back(srcxs[b]);
+				dstys.push_back(srcys[b]);
+			}
+
+			level++;
+		}
+
+		m_lodXs.resize(level);
+		m_lodYs.resize(level);
+	}
 
+	void mvSeries::getDrawData(const float*& xs, const float*& ys, int& count, int& offset) const
+	{
+		xs = m_xs.data();
+		ys = m_ys.data();
+		count = (int)m_xs.size();
+		offset = m_offset;
+
+		if (m_lodXs.empty())
+			return;
+
+		// everything must be submitted while fitting so the extents are correct
+		bool fitting = ImPlot::IsPlotFitting();
 		ImPlotLimits limits = ImPlot::GetPlotLimits();
 
-		std::vector<ImVec2> points;
-		for (unsigned i = 0; i < m_xs.size(); i++)
+		// keeps one point outside the limits on each side so lines reach the edges
+		auto visibleRange = [&](const std::vector<float>& values, size_t& first, size_t& last)
 		{
-			float x = m_xs[i] > limits.X.Max ? limits.X.Max : m_xs[i];
-			x = m_xs[i] < limits.X.Min ? limits.X.Min : x;
+			first = 0;
+			last = values.size();
+			if (fitting)
+				return;
+
+			first = std::lower_bound(values.begin(), values.end(), (float)limits.X.Min) - values.begin();
+			last = std::upper_bound(values.begin(), values.end(), (float)limits.X.Max) - values.begin();
+			first = first > 0 ? first - 1 : 0;
+			last = std::min(last + 1, values.size());
+		};
+
+		size_t first, last;
+		visibleRange(m_xs, first, last);
+
+		// coarsest level that still has a min and max for every pixel column
+		size_t target = 2 * (size_t)std::max(ImPlot::GetPlotSize().x, 1.0f);
+		size_t level = 0;
+		while (level < m_lodXs.size() && ((last - first) >> (2 * (level + 1))) >= target)
+			level++;
 
-			float y = m_ys[i] > limits.Y.Max ? limits.Y.Max : m_ys[i];
-			y = m_ys[i] < limits.Y.Min ? limits.Y.Min : y;
-			auto p = ImPlot::PlotToPixels({ x, y });
-			points.push_back(p);
+		if (level > 0)
+		{
+			visibleRange(m_lodXs[level - 1], first, last);
+			xs = m_lodXs[level - 1].data();
+			ys = m_lodYs[level - 1].data();
 		}
 
-		if (m_fill.specified)
+		xs += first;
+		ys += first;
+		count = (int)(last - first);
+		offset = 0;
+	}
+
+	void mvAreaSeries::drawPolygon()
+	{
+		if (!m_fill.specified || m_xs.empty())
+			return;
+
+		size_t count = m_xs.size();
+
+		// triangulated in plot space so panning and zooming only needs a
+		// projection (log axes bend edges slightly but stay filled)
+		if (m_dirty)
 		{
-			int i;
-			int y;
-			int miny, maxy;
-			int x1, y1;
-			int x2, y2;
-			int ind1, ind2;
-			int ints;
-			size_t n = points.size();
-			int* polyints = new int[n];
-
-			/* Determine Y maxima */
-			miny = (int)points[0].y;
-			maxy = (int)points[0].y;
-			for (i = 1; i < n; i++)
+			std::vector<ImVec2> points;
+			points.reserve(count);
+			for (size_t i = 0; i < count; i++)
 			{
-				miny = std::min(miny, (int)points[i].y);
-				maxy = std::max(maxy, (int)points[i].y);
+				size_t index = (m_offset + i) % count;
+				points.emplace_back(m_xs[index], m_ys[index]);
 			}
 
-			/* Draw, scanning y */
-			for (y = miny; y <= maxy; y++) {
-				ints = 0;
-				for (i = 0; (i < n); i++) {
-					if (!i)
-					{
-						ind1 = (int)n - 1;
-						ind2 = 0;
-					}
-					else
-					{
-						ind1 = i - 1;
-						ind2 = i;
-					}
-					y1 = (int)points[ind1].y;
-					y2 = (int)points[ind2].y;
-					if (y1 < y2)
-					{
-						x1 = (int)points[ind1].x;
-						x2 = (int)points[ind2].x;
-					}
-					else if (y1 > y2)
-					{
-						y2 = (int)points[ind1].y;
-						y1 = (int)points[ind2].y;
-						x2 = (int)points[ind1].x;
-						x1 = (int)points[ind2].x;
-					}
-					else
-						continue;
-
-					if (((y >= y1) && (y < y2)) || ((y == maxy) && (y > y1) && (y <= y2)))
-						polyints[ints++] = (y - y1) * (x2 - x1) / (y2 - y1) + x1;
-
-				}
-
-				auto compare_int = [](const void* a, const void* b)
-				{
-					return (*(const int*)a) - (*(const int*)b);
-				};
+			TriangulatePolygon(points, m_indices);
+			m_pixels.clear();
+			m_dirty = false;
+		}
 
-				qsort(polyints, ints, sizeof(int), compare_int);
+		ImPlotLimits limits = ImPlot::GetPlotLimits();
+		ImVec2 plotPos = ImPlot::GetPlotPos();
+		ImVec2 plotSize = ImPlot::GetPlotSize();
 
-				for (i = 0; i < ints; i += 2)
-					ImGui::GetWindowDrawList()->AddLine({ (float)polyints[i], (float)y }, { (float)polyints[i + 1], (float)y}, m_fill, 1.0f);
+		if (m_pixels.size() != count
+			|| limits.X.Min != m_limits.X.Min || limits.X.Max != m_limits.X.Max
+			|| limits.Y.Min != m_limits.Y.Min || limits.Y.Max != m_limits.Y.Max
+			|| plotPos.x != m_plotPos.x || plotPos.y != m_plotPos.y
+			|| plotSize.x != m_plotSize.x || plotSize.y != m_plotSize.y)
+		{
+			m_pixels.resize(count);
+			for (size_t i = 0; i < count; i++)
+			{
+				size_t index = (m_offset + i) % count;
+				m_pixels[i] = ImPlot::PlotToPixels({ m_xs[index], m_ys[index] });
 			}
-			delete[] polyints;
+
+			m_limits = limits;
+			m_plotPos = plotPos;
+			m_plotSize = plotSize;
 		}
 
+		AddTriangulatedPolygonFilled(ImGui::GetWindowDrawList(), m_pixels, m_indices, m_fill);
 	}
 
-}
\ No newline at end of file
+}
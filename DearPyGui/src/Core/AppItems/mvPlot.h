@@ -4,6 +4,7 @@
 #include <implot.h>
 #include <map>
 #include <utility>
+#include <algorithm>
 #include "mvCore.h"
 
 //-----------------------------------------------------------------------------
@@ -23,8 +24,9 @@ namespace Marvel {
 
 	public:
 
-		mvSeries(std::string  name, const std::vector<mvVec2>& points)
-			: m_name(std::move(name))
+		// only series drawn through getDrawData() use levels of detail
+		mvSeries(std::string  name, const std::vector<mvVec2>& points, bool levels = false)
+			: m_name(std::move(name)), m_levels(levels)
 		{
 			for (auto& point : points)
 			{
@@ -32,17 +34,108 @@ namespace Marvel {
 				m_ys.push_back(point.y);
 			}
 
+			m_sorted = std::is_sorted(m_xs.begin(), m_xs.end());
+			buildLevels(0);
 		}
 
 		virtual ~mvSeries() = default;
 
 		virtual void draw() = 0;
 
+		[[nodiscard]] const std::string& getName() const { return m_name; }
+
+		// takes ownership of already split coordinates (i.e. from buffers)
+		void setData(std::vector<float> xs, std::vector<float> ys)
+		{
+			m_xs = std::move(xs);
+			m_ys = std::move(ys);
+			m_offset = 0;
+			m_sorted = std::is_sorted(m_xs.begin(), m_xs.end());
+			trimToCapacity();
+			buildLevels(0);
+			m_dirty = true;
+		}
+
+		// a capacity of 0 means the series grows without bound, otherwise
+		// the series acts as a ring buffer keeping the latest points
+		void setCapacity(size_t capacity)
+		{
+			m_capacity = capacity;
+			trimToCapacity();
+			buildLevels(0);
+			m_dirty = true;
+		}
+
+		// costs O(new points), old points are overwritten in place once
+		// the ring buffer is full
+		void appendData(const std::vector<float>& xs, const std::vector<float>& ys)
+		{
+			size_t count = std::min(xs.size(), ys.size());
+			size_t first = m_xs.size();
+
+			for (size_t i = 0; i < count; i++)
+			{
+				if (m_capacity == 0 || m_xs.size() < m_capacity)
+				{
+					if (!m_xs.empty() && xs[i] < m_xs.back())
+						m_sorted = false;
+					m_xs.push_back(xs[i]);
+					m_ys.push_back(ys[i]);
+				}
+				else
+				{
+					m_xs[m_offset] = xs[i];
+					m_ys[m_offset] = ys[i];
+					m_offset = (m_offset + 1) % (int)m_capacity;
+				}
+			}
+
+			buildLevels(first);
+			m_dirty = true;
+		}
+
+	protected:
+
+		// Picks the level of detail matching the current plot limits and
+		// pixel width and returns the slice of it that should be submitted.
+		// Must be called between ImPlot::BeginPlot() and ImPlot::EndPlot().
+		void getDrawData(const float*& xs, const float*& ys, int& count, int& offset) const;
+
+	private:
+
+		// Rebuilds the min/max pyramid starting at raw index "first". Each
+		// level keeps the min and max point of every chunk of the level
+		// below, so peaks survive decimation. Only used for unbounded series
+		// with increasing x values that were constructed with levels.
+		void buildLevels(size_t first);
+
+		void trimToCapacity()
+		{
+			if (m_capacity == 0 || m_xs.size() <= m_capacity)
+				return;
+
+			// keep the latest points in chronological order
+			std::rotate(m_xs.begin(), m_xs.begin() + m_offset, m_xs.end());
+			std::rotate(m_ys.begin(), m_ys.begin() + m_offset, m_ys.end());
+			m_xs.erase(m_xs.begin(), m_xs.end() - m_capacity);
+			m_ys.erase(m_ys.begin(), m_ys.end() - m_capacity);
+			m_offset = 0;
+		}
+
 	protected:
 
 		std::string        m_name;
 		std::vector<float> m_xs;
 		std::vector<float> m_ys;
+		size_t             m_capacity = 0;
+		int                m_offset = 0; // index of the oldest point when used as a ring buffer
+		bool               m_sorted = true;
+		bool               m_dirty = true; // data changed since caches were built
+		bool               m_levels;       // builds the level of detail pyramid
+
+		// level of detail pyramid (level 0 is m_xs/m_ys and is not stored)
+		std::vector<std::vector<float>> m_lodXs;
+		std::vector<std::vector<float>> m_lodYs;
 
 	};
 
@@ -60,10 +153,16 @@ namespace Marvel {
 			std::string  yname="", int width = -1, int height = 0, ImPlotFlags flags = ImPlotFlags_Default,
 			ImPlotAxisFlags xflags = ImPlotAxisFlags_Default, ImPlotAxisFlags yflags = ImPlotAxisFlags_Default, std::string  queryCallback = "")
 			: mvAppItem(parent, name), m_xaxisName(std::move(xname)), m_yaxisName(std::move(yname)),
-			m_flags(flags), m_xflags(xflags), m_yflags(yflags), m_queryCallback(std::move(queryCallback))
+			m_flags(flags), m_xflags(xflags), m_yflags(yflags)
 		{
 			m_width = width;
 			m_height = height;
+			ReplaceCallback(m_queryCallback, queryCallback);
+		}
+
+		~mvPlot() override
+		{
+			ReleaseCallback(m_queryCallback);
 		}
 
 		void addSeries(mvSeries* series)
@@ -71,6 +170,17 @@ namespace Marvel {
 			m_series.push_back(series);
 		}
 
+		mvSeries* getSeries(const std::string& name)
+		{
+			for (auto series : m_series)
+			{
+				if (series->getName() == name)
+					return series;
+			}
+
+			return nullptr;
+		}
+
 		void SetColorMap(ImPlotColormap colormap)
 		{
 			m_colormap = colormap;
@@ -250,7 +360,7 @@ namespace Marvel {
 
 		mvLineSeries(const std::string& name, const std::vector<mvVec2>& points, float weight=1.0f,
 			mvColor color = MV_DEFAULT_COLOR, mvColor fill = MV_DEFAULT_COLOR)
-			: mvSeries(name, points), m_lineWeight(weight), m_color(color), m_fill(fill)
+			: mvSeries(name, points, true), m_lineWeight(weight), m_color(color), m_fill(fill)
 		{
 		}
 
@@ -263,10 +373,15 @@ namespace Marvel {
 
 			ImPlot::PushStyleVar(ImPlotStyleVar_LineWeight, m_lineWeight);
 
+			const float* xs;
+			const float* ys;
+			int count, offset;
+			getDrawData(xs, ys, count, offset);
+
 			if (m_fill.specified)
-				ImPlot::PlotShaded(m_name.c_str(), m_xs.data(), m_ys.data(), m_xs.size());
+				ImPlot::PlotShaded(m_name.c_str(), xs, ys, count, 0.0f, offset);
 			else
-				ImPlot::PlotLine(m_name.c_str(), m_xs.data(), m_ys.data(), m_xs.size());
+				ImPlot::PlotLine(m_name.c_str(), xs, ys, count, offset);
 
 			if (m_color.specified)
 				ImPlot::PopStyleColor();
@@ -294,7 +409,7 @@ namespace Marvel {
 
 		mvScatterSeries(const std::string& name, const std::vector<mvVec2>& points, int marker=2, float markerSize=4.0f, float markerWeight =1.0f,
 			mvColor markerOutlineColor = MV_DEFAULT_COLOR, mvColor markerFillColor = MV_DEFAULT_COLOR)
-			: mvSeries(name, points), m_marker(marker), m_markerSize(markerSize), m_markerWeight(markerWeight),
+			: mvSeries(name, points, true), m_marker(marker), m_markerSize(markerSize), m_markerWeight(markerWeight),
 			m_markerOutlineColor(markerOutlineColor), m_markerFillColor(markerFillColor)
 		{
 		}
@@ -310,7 +425,12 @@ namespace Marvel {
 			ImPlot::PushStyleVar(ImPlotStyleVar_MarkerSize, m_markerSize);
 			ImPlot::PushStyleVar(ImPlotStyleVar_MarkerWeight, m_markerWeight);
 
-			ImPlot::PlotScatter(m_name.c_str(), m_xs.data(), m_ys.data(), m_xs.size());
+			const float* xs;
+			const float* ys;
+			int count, offset;
+			getDrawData(xs, ys, count, offset);
+
+			ImPlot::PlotScatter(m_name.c_str(), xs, ys, count, offset);
 
 			if (m_markerOutlineColor.specified)
 				ImPlot::PopStyleColor();
@@ -389,6 +509,14 @@ namespace Marvel {
 		float m_weight = 1.0f;
 		mvColor m_color = MV_DEFAULT_COLOR;
 		mvColor m_fill = MV_DEFAULT_COLOR;
+
+		// fill cache, triangulated when the data changes and
+		// projected when the plot limits or plot area change
+		std::vector<unsigned> m_indices;
+		std::vector<ImVec2>   m_pixels;
+		ImPlotLimits          m_limits;
+		ImVec2                m_plotPos;
+		ImVec2                m_plotSize;
 	};
 
 }
\ No newline at end of file
@@ -1,6 +1,7 @@
 #pragma once
 
 #include "Core/AppItems/mvTypeBases.h"
+#include "Core/mvProfiler.h"
 
 //-----------------------------------------------------------------------------
 // Widget Index
@@ -53,6 +54,7 @@ namespace Marvel {
 							ImGui::SetNextItemWidth((float)item->getWidth());
 
 						item->pushColorStyles();
+						MV_PROFILE_SCOPE(item->getName());
 						item->draw();
 						item->popColorStyles();
 
@@ -97,6 +99,7 @@ namespace Marvel {
 							ImGui::SetNextItemWidth((float)item->getWidth());
 
 						item->pushColorStyles();
+						MV_PROFILE_SCOPE(item->getName());
 						item->draw();
 						item->popColorStyles();
 
@@ -1,6 +1,7 @@
 #pragma once
 
 #include "Core/AppItems/mvTypeBases.h"
+#include "Core/mvProfiler.h"
 #include "mvApp.h"
 
 //-----------------------------------------------------------------------------
@@ -47,6 +48,7 @@ namespace Marvel {
 						ImGui::SetNextItemWidth((float)item->getWidth());
 
 					item->pushColorStyles();
+					MV_PROFILE_SCOPE(item->getName());
 					item->draw();
 					item->popColorStyles();
 
@@ -142,6 +144,7 @@ namespace Marvel {
 						ImGui::SetNextItemWidth((float)item->getWidth());
 
 					item->pushColorStyles();
+					MV_PROFILE_SCOPE(item->getName());
 					item->draw();
 					item->popColorStyles();
 
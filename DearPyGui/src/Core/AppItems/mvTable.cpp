@@ -3,6 +3,7 @@
 #include "mvApp.h"
 #include "mvAppLog.h"
 #include "Core/mvPythonExceptions.h"
+#include <algorithm>
 
 namespace Marvel {
 
@@ -30,27 +31,12 @@ namespace Marvel {
 		return true;
 	}
 
-	void mvTable::updateHashValues()
-	{
-		m_hashValues.clear();
-
-		m_hashValues = m_values;
-
-		for (size_t i = 0; i < m_hashValues.size(); i++)
-		{
-			for (size_t j = 0; j < m_hashValues[i].size(); j++)
-				m_hashValues[i][j] = m_hashValues[i][j] + "##" + m_name + "-" + std::to_string(i) + "-" + std::to_string(j);
-		}
-	}
-
 	void mvTable::setTableItem(int row, int column, const std::string& value)
 	{
 		if (!isIndexValid(row, column))
 			return;
 
 		m_values[row][column] = value;
-		m_hashValues[row][column] = value + "##" + m_name + "-" + std::to_string(row) + "-" + std::to_string(column);
-
 	}
 
 	std::string mvTable::getTableItem(int row, int column) const
@@ -66,19 +52,21 @@ namespace Marvel {
 		if (!isIndexValid(row, column))
 			return;
 
-		m_selections[{row, column}] = value;
+		if (value)
+			m_selections.insert(SelectionKey(row, column));
+		else
+			m_selections.erase(SelectionKey(row, column));
 	}
 
 	void mvTable::setPyValue(PyObject* value)
 	{
-		auto values = mvPythonTranslator::ToVectVectString(value, m_name + " requires a list/tuple or list/tuple of strings.");
-
-		m_values = values;
-
-		while (m_headers.size() > m_values[0].size())
-			m_headers.pop_back();
+		m_values = mvPythonTranslator::ToVectVectString(value, m_name + " requires a list/tuple or list/tuple of strings.");
 
-		updateHashValues();
+		if (!m_values.empty())
+		{
+			while (m_headers.size() > m_values[0].size())
+				m_headers.pop_back();
+		}
 
 		m_selections.clear();
 	}
@@ -90,20 +78,48 @@ namespace Marvel {
 
 	PyObject* mvTable::getSelections() const
 	{
-		int selectionCount = 0;
+		std::vector<std::pair<int, int>> selections;
+		selections.reserve(m_selections.size());
 
-		for (auto& item : m_selections)
-			if (item.second) selectionCount++;
+		for (auto key : m_selections)
+			selections.emplace_back(SelectionRow(key), SelectionColumn(key));
 
-		std::vector<std::pair<int, int>> selections;
+		// keep row major order
+		std::sort(selections.begin(), selections.end());
+		
+		return mvPythonTranslator::ToPyList(selections);
+	}
+
+	void mvTable::shiftSelectionRows(int row, int shift)
+	{
+		std::unordered_set<std::uint64_t> selections;
+		selections.reserve(m_selections.size());
+
+		for (auto key : m_selections)
+		{
+			int selectedRow = SelectionRow(key);
+			if (shift < 0 && selectedRow == row)
+				continue;
+			selections.insert(SelectionKey(selectedRow >= row ? selectedRow + shift : selectedRow, SelectionColumn(key)));
+		}
 
-		for (auto& item : m_selections)
+		m_selections = std::move(selections);
+	}
+
+	void mvTable::shiftSelectionColumns(int column, int shift)
+	{
+		std::unordered_set<std::uint64_t> selections;
+		selections.reserve(m_selections.size());
+
+		for (auto key : m_selections)
 		{
-			if (item.second)
-				selections.emplace_back(item.first.first, item.first.second);
+			int selectedColumn = SelectionColumn(key);
+			if (shift < 0 && selectedColumn == column)
+				continue;
+			selections.insert(SelectionKey(SelectionRow(key), selectedColumn >= column ? selectedColumn + shift : selectedColumn));
 		}
-		
-		return mvPythonTranslator::ToPyList(selections);
+
+		m_selections = std::move(selections);
 	}
 
 	void mvTable::addHeaders(const std::vector<std::string>& headers) 
@@ -117,7 +133,7 @@ namespace Marvel {
 		if (m_columns > m_values[0].size())
 		{
 			for (auto& row : m_values)
-				row.emplace_back("");
+				row.resize(m_columns);
 		}
 		else if (m_columns < m_values[0].size())
 		{
@@ -125,67 +141,26 @@ namespace Marvel {
 			while (m_headers.size() < m_columns)
 				m_headers.emplace_back("Header");
 		}
-		updateHashValues();
 	}
 
 	void mvTable::addRow(const std::vector<std::string>& row)
 	{
 		m_values.push_back(row);
-
-		while (m_values.back().size() < m_headers.size())
-			m_values.back().emplace_back("");
-
-		while (m_values.back().size() > m_headers.size())
-			m_values.back().pop_back();
-
-		updateHashValues();
+		m_values.back().resize(m_headers.size());
 	}
 
 	void mvTable::addColumn(const std::string& name, const std::vector<std::string>& column)
 	{
-		m_headers.push_back(name);
-
-		if (column.size() > m_values.size())
-		{
-			for (unsigned i = 0; i < column.size(); i++)
-			{
-				// row exists
-				if (i < m_values.size())
-				{
-					m_values[i].emplace_back(column[i]);
-					continue;
-				}
-
-				// row does not exist
-				m_values.push_back({});
-				for (unsigned j = 0; j < m_headers.size() - 1; j++)
-					m_values[i].emplace_back("");
+		// rows the column is longer than
+		while (m_values.size() < column.size())
+			m_values.emplace_back(m_headers.size(), "");
 
-				m_values[i].emplace_back(column[i]);
-			}
-		}
-
-		else
-		{
-			int index = 0;
-			for (auto& row : m_values)
-			{
-				if (index >= column.size())
-				{
-					row.emplace_back("");
-					index++;
-					continue;
+		m_headers.push_back(name);
 
-				}
-
-				row.push_back(column[index]);
-				index++;
-			}
-		}
+		for (size_t i = 0; i < m_values.size(); i++)
+			m_values[i].push_back(i < column.size() ? column[i] : "");
 
 		m_columns++;
-
-		updateHashValues();
 	}
 
 	void mvTable::insertColumn(int column_index, const std::string& name, const std::vector<std::string>& column)
@@ -193,121 +168,27 @@ namespace Marvel {
 		if (!isIndexValid(0, column_index))
 			return;
 
-		if (column_index == m_headers.size())
+		if (column_index >= (int)m_headers.size())
 		{
 			addColumn(name, column);
 			return;
 		}
 
-		auto oldValues = m_values;
-		auto oldHeaders = m_headers;
+		// rows the column is longer than
+		while (m_values.size() < column.size())
+			m_values.emplace_back(m_headers.size(), "");
 
-		m_values.clear();
-		m_headers.clear();
+		m_headers.insert(m_headers.begin() + column_index, name);
 		m_columns++;
 
-		for (size_t i = 0; i < m_columns; i++)
-		{
-			if (i < column_index)
-				m_headers.push_back(oldHeaders[i]);
-			else if (i == column_index)
-				m_headers.push_back(name);
-			else
-				m_headers.push_back(oldHeaders[i - 1]);
-		}
-
-		if (column.size() > oldValues.size())
-		{
-			for (size_t i = 0; i < column.size(); i++)
-			{
-				if (i < oldValues.size())
-				{
-					std::vector<std::string> row;
-					for (size_t j = 0; j < oldHeaders.size(); j++)
-					{
-						if (j == column_index)
-						{
-							row.push_back(column[i]);
-							continue;
-						}
-
-						if (j > column_index)
-							row.push_back(oldValues[i][j - 1]);
-
-						else
-							row.push_back(oldValues[i][j]);
-
-					}
-					row.push_back(oldValues[i].back());
-
-					m_values.push_back(row);
-				}
-
-				else
-				{
-					std::vector<std::string> row;
-					for (size_t j = 0; j < oldHeaders.size(); j++)
-					{
-						if (j == column_index)
-						{
-							row.push_back(column[i]);
-							continue;
-						}
-						row.push_back("");
-					}
-					row.push_back("");
-
-					m_values.push_back(row);
-				}
-			}
-		}
-
-		else
-		{
-			for (size_t i = 0; i < oldValues.size(); i++)
-			{
-				std::vector<std::string> row;
-				for (size_t j = 0; j < oldHeaders.size(); j++)
-				{
-					if (j == column_index)
-					{
-						if (i >= column.size())
-							row.emplace_back("");
-						else
-							row.push_back(column[i]);
-						continue;
-					}
-
-					if (j > column_index)
-						row.push_back(oldValues[i][j - 1]);
-
-					else
-						row.push_back(oldValues[i][j]);
-
-				}
-				row.push_back(oldValues[i].back());
-
-				m_values.push_back(row);
-			}
-		}
-
-		updateHashValues();
-
-		// update selections
-		std::map<std::pair<int, int>, bool> oldSelection = m_selections;
-		m_selections.clear();
-
-		for (auto& item : oldSelection)
+		for (size_t i = 0; i < m_values.size(); i++)
 		{
-
-			if (item.first.second >= column_index)
-				m_selections[{item.first.first, item.first.second + 1}] = item.second;
-
-			else
-				m_selections[item.first] = item.second;
-
+			auto& row = m_values[i];
+			size_t index = std::min((size_t)column_index, row.size());
+			row.insert(row.begin() + index, i < column.size() ? column[i] : "");
 		}
 
+		shiftSelectionColumns(column_index, 1);
 	}
 
 	void mvTable::insertRow(int row_index, const std::vector<std::string>& row)
@@ -315,94 +196,32 @@ namespace Marvel {
 		if (!isIndexValid(row_index, 0))
 			return;
 
-		if (row_index >= m_values.size())
+		if (row_index >= (int)m_values.size())
 		{
 			addRow(row);
 			return;
 		}
 
-		auto oldValues = m_values;
-
-		m_values.clear();
-
-		for (size_t i = 0; i < oldValues.size(); i++)
-		{
-			if (i == row_index)
-			{
-				m_values.push_back(row);
-				continue;
-			}
-
-			if(i > row_index)
-				m_values.push_back(oldValues[i-1]);
-			else
-				m_values.push_back(oldValues[i]);
-		}
-		m_values.push_back(oldValues.back());
-
-		while (m_values[row_index].size() < m_headers.size())
-			m_values[row_index].emplace_back("");
-
-		while (m_values.back().size() > m_headers.size())
-			m_values.back().pop_back();
-
-		updateHashValues();
-
-		// update selections
-		std::map<std::pair<int, int>, bool> oldSelection = m_selections;
-		m_selections.clear();
-
-		for (auto& item : oldSelection)
-		{
-
-			if (item.first.first >= row_index)
-				m_selections[{item.first.first + 1, item.first.second}] = item.second;
-
-			else
-				m_selections[item.first] = item.second;
-			
-		}
+		m_values.insert(m_values.begin() + row_index, row);
+		m_values[row_index].resize(m_headers.size());
 
+		shiftSelectionRows(row_index, 1);
 	}
 
 	void mvTable::deleteRow(int row)
 	{
 		if (!isIndexValid(row, 0))
-			return ;
-
-		auto oldValues = m_values;
-
-		m_values.clear();
+			return;
 
-		int index = 0;
-		for (auto& item : oldValues)
+		if (row >= (int)m_values.size())
 		{
-			index++;
-			if (index == row)
-				continue;
-			m_values.push_back(item);
-			
+			ThrowPythonException("Row to delete does not exist.");
+			return;
 		}
 
-		updateHashValues();
-
-		// update selections
-		std::map<std::pair<int, int>, bool> oldSelection = m_selections;
-		m_selections.clear();
-
-		for (auto& item : oldSelection)
-		{
-			if (item.first.first == row)
-				continue;
-
-			else if (item.first.first < row)
-				m_selections[item.first] = item.second;
-
-
-			else if (item.first.first > row)
-				m_selections[{item.first.first - 1, item.first.second}] = item.second;
-		}
+		m_values.erase(m_values.begin() + row);
 
+		shiftSelectionRows(row, -1);
 	}
 
 	void mvTable::deleteColumn(int column)
@@ -410,65 +229,67 @@ namespace Marvel {
 		if (!isIndexValid(0, column))
 			return;
 
-		if (column >= m_headers.size())
+		if (column >= (int)m_headers.size())
 		{
 			ThrowPythonException("Column to delete does not exist.");
 			return;
 		}
 
-		auto oldValues = m_values;
-		auto oldHeaders = m_headers;
-
-		m_values.clear();
-		m_headers.clear();
+		m_headers.erase(m_headers.begin() + column);
 		m_columns--;
 
-		for (size_t i = 0; i < oldHeaders.size(); i++)
+		for (auto& row : m_values)
 		{
-			if (i == column)
-				continue;
-			m_headers.push_back(oldHeaders[i]);
-		}
-
-		//for (int i = 0; i < oldValues.size(); i++)
-		for (auto& oldvalue : oldValues)
-		{
-			std::vector<std::string> row;
-			for (size_t j = 0; j < oldHeaders.size(); j++)
-			{
-				if (j == column)
-					continue;
-				row.push_back(oldvalue[j]);
-			}
-
-			m_values.push_back(row);
+			if (column < (int)row.size())
+				row.erase(row.begin() + column);
 		}
 
-		updateHashValues();
+		shiftSelectionColumns(column, -1);
+	}
 
-		// update selections
-		std::map<std::pair<int, int>, bool> oldSelection = m_selections;
+	void mvTable::clearTable()
+	{
 		m_selections.clear();
-		for (auto& item : oldSelection)
-		{
-			if (item.first.second == column)
-				continue;
+		m_values.clear();
+	}
 
-			else if (item.first.second < column)
-				m_selections[item.first] = item.second;
+	void mvTable::setColumns(std::vector<std::vector<std::string>> columns)
+	{
+		size_t rows = 0;
+		for (const auto& column : columns)
+			rows = std::max(rows, column.size());
 
+		while (m_headers.size() < columns.size())
+			m_headers.emplace_back("Header" + std::to_string(m_headers.size()));
+		m_headers.resize(columns.size());
+		m_columns = (int)columns.size();
 
-			else if (item.first.second > column)
-				m_selections[{item.first.first, item.first.second - 1}] = item.second;
+		m_values.assign(rows, std::vector<std::string>(columns.size()));
+		for (size_t j = 0; j < columns.size(); j++)
+		{
+			for (size_t i = 0; i < columns[j].size(); i++)
+				m_values[i][j] = std::move(columns[j][i]);
 		}
 
+		m_selections.clear();
 	}
 
-	void mvTable::clearTable()
+	void mvTable::setRows(int start, std::vector<std::vector<std::string>> rows)
 	{
-		m_selections.clear();
-		m_hashValues.clear();
-		m_values.clear();
+		if (start < 0 || start > (int)m_values.size())
+		{
+			ThrowPythonException("Table indices out of range.");
+			return;
+		}
+
+		if (start + rows.size() > m_values.size())
+			m_values.resize(start + rows.size());
+
+		for (size_t i = 0; i < rows.size(); i++)
+		{
+			rows[i].resize(m_headers.size());
+			m_values[start + i] = std::move(rows[i]);
+		}
 	}
 
 	void mvTable::draw()
@@ -485,20 +306,34 @@ namespace Marvel {
 		}
 		ImGui::Separator();
 
-		int index = 0;
-		for (size_t i = 0; i < m_hashValues.size(); i++)
+		// only the visible rows are submitted, cells are identified by
+		// their row/column on the id stack instead of by their label
+		ImGuiListClipper clipper;
+		clipper.Begin((int)m_values.size());
+		while (clipper.Step())
 		{
-			for (size_t j = 0; j < m_columns; j++)
+			for (int i = clipper.DisplayStart; i < clipper.DisplayEnd; i++)
 			{
-				if (ImGui::Selectable(m_hashValues[i][j].c_str(), m_selections[{i, j}]))
+				ImGui::PushID(i);
+				for (int j = 0; j < m_columns; j++)
 				{
-					m_selections[{i, j}] = !m_selections[{i, j}];
-					mvApp::GetApp()->runCallback(m_callback, m_name);
+					ImGui::PushID(j);
+					bool selected = isSelected(i, j);
+					if (ImGui::Selectable(m_values[i][j].c_str(), selected))
+					{
+						if (selected)
+							m_selections.erase(SelectionKey(i, j));
+						else
+							m_selections.insert(SelectionKey(i, j));
+						mvApp::GetApp()->runCallback(m_callback, m_name);
+					}
+					ImGui::PopID();
+					ImGui::NextColumn();
 				}
-				ImGui::NextColumn();
-				index++;
+				ImGui::PopID();
 			}
 		}
+		clipper.End();
 
 		ImGui::Columns(1);
 		ImGui::Separator();
@@ -1,5 +1,7 @@
 #pragma once
 
+#include <cstdint>
+#include <unordered_set>
 #include "mvAppItem.h"
 #include "mvApp.h"
 #include "mvAppLog.h"
@@ -33,6 +35,8 @@ namespace Marvel {
 		void insertColumn  (int column_index, const std::string& name, const std::vector<std::string>& column);
 		void deleteColumn  (int column);
 		void clearTable    ();
+		void setColumns    (std::vector<std::vector<std::string>> columns);
+		void setRows       (int start, std::vector<std::vector<std::string>> rows);
 		int  getColumnCount() const { return m_columns; }
 
 		[[nodiscard]] std::string getTableItem (int row, int column) const;
@@ -45,13 +49,22 @@ namespace Marvel {
 	private:
 
 		[[nodiscard]] bool isIndexValid(int row, int column) const;
-		void               updateHashValues();
+
+		// selections are only stored for selected cells
+		static std::uint64_t SelectionKey(int row, int column) { return ((std::uint64_t)(std::uint32_t)row << 32) | (std::uint32_t)column; }
+		static int           SelectionRow(std::uint64_t key) { return (int)(key >> 32); }
+		static int           SelectionColumn(std::uint64_t key) { return (int)(key & 0xFFFFFFFF); }
+		[[nodiscard]] bool   isSelected(int row, int column) const { return m_selections.count(SelectionKey(row, column)) > 0; }
+
+		// shifts selections at or after row/column by shift, a negative
+		// shift drops the selections of the deleted row/column
+		void shiftSelectionRows   (int row, int shift);
+		void shiftSelectionColumns(int column, int shift);
 
 	private:
 
-		std::map<std::pair<int, int>, bool>   m_selections;
+		std::unordered_set<std::uint64_t>     m_selections;
 		std::vector<std::string>              m_headers;
-		std::vector<std::vector<std::string>> m_hashValues;
 		std::vector<std::vector<std::string>> m_values;
 		int                                   m_columns;
 
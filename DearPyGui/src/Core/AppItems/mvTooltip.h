@@ -1,6 +1,7 @@
 #pragma once
 
 #include "Core/AppItems/mvTypeBases.h"
+#include "Core/mvProfiler.h"
 
 //-----------------------------------------------------------------------------
 // Widget Index
@@ -50,6 +51,7 @@ namespace Marvel {
 						ImGui::SetNextItemWidth((float)item->getWidth());
 
 					item->pushColorStyles();
+					MV_PROFILE_SCOPE(item->getName());
 					item->draw();
 					item->popColorStyles();
 
@@ -36,11 +36,28 @@ namespace Marvel {
 			m_value = mvPythonTranslator::ToBool(value, m_name + " requires a bool value."); 
 		}
 
+		bool setDataValue(const mvDataValue& value) override
+		{
+			if (value.type != mvDataType::Bool && value.type != mvDataType::Int)
+				return false;
+
+			m_value = value.ints[0] != 0;
+			return true;
+		}
+
 		[[nodiscard]] PyObject* getPyValue() const override
 		{
 			return mvPythonTranslator::ToPyBool(m_value);
 		}
 
+		[[nodiscard]] mvDataValue getDataValue() const
+		{
+			mvDataValue value;
+			value.type = mvDataType::Bool;
+			value.ints.push_back(m_value);
+			return value;
+		}
+
 		[[nodiscard]] bool getValue() const { return m_value; }
 		void               setValue(bool value) { m_value = value; }
 
@@ -68,11 +85,28 @@ namespace Marvel {
 			m_value = mvPythonTranslator::ToString(value, m_name + " requires a string value.");
 		}
 
+		bool setDataValue(const mvDataValue& value) override
+		{
+			if (value.type != mvDataType::String)
+				return false;
+
+			m_value = value.strings[0];
+			return true;
+		}
+
 		[[nodiscard]] PyObject* getPyValue() const override
 		{
 			return mvPythonTranslator::ToPyString(m_value);
 		}
 
+		[[nodiscard]] mvDataValue getDataValue() const
+		{
+			mvDataValue value;
+			value.type = mvDataType::String;
+			value.strings.push_back(m_value);
+			return value;
+		}
+
 		[[nodiscard]] const std::string& getValue() const { return m_value; }
 		inline void                      setValue(const std::string& value) { m_value = value; }
 
@@ -111,6 +145,27 @@ namespace Marvel {
 
 		}
 
+		bool setDataValue(const mvDataValue& value) override
+		{
+			switch (value.type)
+			{
+			case mvDataType::Int:
+			case mvDataType::IntList:
+				for (size_t i = 0; i < value.ints.size() && i < m_value.size(); i++)
+					m_value[i] = value.ints[i];
+				return true;
+
+			case mvDataType::Float:
+			case mvDataType::FloatList:
+				for (size_t i = 0; i < value.floats.size() && i < m_value.size(); i++)
+					m_value[i] = (int)value.floats[i];
+				return true;
+
+			default:
+				return false;
+			}
+		}
+
 		[[nodiscard]] PyObject* getPyValue() const override
 		{
 			if (m_valuecount == 1)
@@ -120,6 +175,23 @@ namespace Marvel {
 				return mvPythonTranslator::ToPyList(m_value);
 		}
 
+		[[nodiscard]] mvDataValue getDataValue() const
+		{
+			mvDataValue value;
+			if (m_valuecount == 1)
+			{
+				value.type = mvDataType::Int;
+				value.ints.push_back(m_value[0]);
+			}
+
+			else
+			{
+				value.type = mvDataType::IntList;
+				value.ints = m_value;
+			}
+			return value;
+		}
+
 	protected:
 
 		unsigned         m_valuecount = 1;
@@ -155,6 +227,27 @@ namespace Marvel {
 
 		}
 
+		bool setDataValue(const mvDataValue& value) override
+		{
+			switch (value.type)
+			{
+			case mvDataType::Float:
+			case mvDataType::FloatList:
+				for (size_t i = 0; i < value.floats.size() && i < m_value.size(); i++)
+					m_value[i] = value.floats[i];
+				return true;
+
+			case mvDataType::Int:
+			case mvDataType::IntList:
+				for (size_t i = 0; i < value.ints.size() && i < m_value.size(); i++)
+					m_value[i] = (float)value.ints[i];
+				return true;
+
+			default:
+				return false;
+			}
+		}
+
 		[[nodiscard]] PyObject* getPyValue() const override
 		{
 			if (m_valuecount == 1)
@@ -164,6 +257,23 @@ namespace Marvel {
 				return mvPythonTranslator::ToPyList(m_value);
 		}
 
+		[[nodiscard]] mvDataValue getDataValue() const
+		{
+			mvDataValue value;
+			if (m_valuecount == 1)
+			{
+				value.type = mvDataType::Float;
+				value.floats.push_back(m_value[0]);
+			}
+
+			else
+			{
+				value.type = mvDataType::FloatList;
+				value.floats = m_value;
+			}
+			return value;
+		}
+
 	protected:
 
 		unsigned           m_valuecount = 1;
@@ -200,6 +310,25 @@ namespace Marvel {
 			}		
 		}
 
+		bool setDataValue(const mvDataValue& value) override
+		{
+			if (value.type == mvDataType::FloatList)
+			{
+				for (size_t i = 0; i < value.floats.size() && i < 4; i++)
+					m_value[i] = value.floats[i] / 255.0f;
+				return true;
+			}
+
+			if (value.type == mvDataType::IntList)
+			{
+				for (size_t i = 0; i < value.ints.size() && i < 4; i++)
+					m_value[i] = (float)value.ints[i] / 255.0f;
+				return true;
+			}
+
+			return false;
+		}
+
 		[[nodiscard]] PyObject* getPyValue() const override
 		{
 			std::vector<int> ints;
@@ -208,6 +337,15 @@ namespace Marvel {
 			return mvPythonTranslator::ToPyList(ints);
 		}
 
+		[[nodiscard]] mvDataValue getDataValue() const
+		{
+			mvDataValue value;
+			value.type = mvDataType::IntList;
+			for (const auto& item : m_value)
+				value.ints.push_back(item * 255);
+			return value;
+		}
+
 	protected:
 
 		std::vector<float> m_value;
@@ -3,6 +3,7 @@
 #include <utility>
 
 #include "Core/AppItems/mvTypeBases.h"
+#include "Core/mvProfiler.h"
 #include "mvApp.h"
 #include "mvEventHandler.h"
 
@@ -119,6 +120,7 @@ namespace Marvel {
 					ImGui::SetNextItemWidth((float)item->getWidth());
 
 				item->pushColorStyles();
+				MV_PROFILE_SCOPE(item->getName());
 				item->draw();
 				item->popColorStyles();
 
@@ -84,6 +84,11 @@ namespace Marvel {
 				DebugItem("ImGui Version: ", IMGUI_VERSION);
 				DebugItem("Stored Data: ", std::to_string(mvDataStorage::GetDataCount()).c_str());
 				DebugItem("Stored Textures: ", std::to_string(mvTextureStorage::GetTextureCount()).c_str());
+				const mvTextureStats& textureStats = mvTextureStorage::GetStats();
+				DebugItem("Texture Memory: ", (std::to_string(textureStats.bytes / 1024) + " / " + std::to_string(mvTextureStorage::GetMemoryBudget() / 1024) + " KB").c_str());
+				DebugItem("Textures Loaded (Unused): ", (std::to_string(textureStats.count) + " (" + std::to_string(textureStats.unused) + ")").c_str());
+				DebugItem("Texture Hits/Misses: ", (std::to_string(textureStats.hits) + " / " + std::to_string(textureStats.misses)).c_str());
+				DebugItem("Texture Evictions: ", std::to_string(textureStats.evictions).c_str());
 				DebugItem("Threads Active: ", std::to_string(app->getThreadCount()).c_str());
 				DebugItem("Threadpool Timeout: ", std::to_string(app->getThreadPoolTimeout()).c_str());
 				DebugItem("Threadpool Active: ", app->usingThreadPool() ? ts : fs);
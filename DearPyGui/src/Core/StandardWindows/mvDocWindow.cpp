@@ -423,6 +423,11 @@ namespace Marvel {
 					CodeColorText("    ...");
 					ImGui::Unindent();
 					ImGui::BulletText("Where data is the return value of the async function (if anything is returned).");
+					ImGui::BulletText("Async functions can also call set_value, add_data, delete_item and add_* widget");
+					ImGui::Text("    commands directly. These are applied at the start of the next frame.");
+					ImGui::BulletText("Container commands (add_group, add_child, end_*, etc.) use the parent stack and");
+					ImGui::Text("    can't be called from async functions. Widgets added without a parent go to the");
+					ImGui::Text("    main window, so pass parent to add them to an existing container.");
 					ImGui::Separator();
 
 					ColorText("THREADPOOL:");
@@ -27,7 +27,7 @@ namespace Marvel {
 				mvApp::GetApp()->runCallback(m_callback, "File Dialog", mvPythonTranslator::ToPyPair(m_filePathName, m_filePath));
 				m_filePath = "";
 				m_filePathName = "";
-				m_callback = "";
+				ReplaceCallback(m_callback, "");
 				// action
 			}
 			// close
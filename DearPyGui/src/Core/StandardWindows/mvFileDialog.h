@@ -9,7 +9,7 @@ namespace Marvel {
 
 	public:
 
-		void setCallback(const char* callback) { m_callback = callback; }
+		void setCallback(const char* callback) { ReplaceCallback(m_callback, callback); }
 
 		void render(bool& show) override;
 
@@ -2,6 +2,8 @@
 #include <imgui.h>
 #include "mvApp.h"
 #include "Core/mvInput.h"
+#include "Core/mvProfiler.h"
+#include "Core/AppItems/mvDrawing.h"
 
 namespace Marvel {
 
@@ -21,6 +23,12 @@ namespace Marvel {
 		ImGui::Text("%d active windows (%d visible)", io.MetricsActiveWindows, io.MetricsRenderWindows);
 		ImGui::Text("%d active allocations", io.MetricsActiveAllocations);
 
+		mvDrawingStats drawings = mvDrawing::GetStats();
+		ImGui::Text("%d drawings, %d drawing commands submitted (%d culled)", drawings.drawings, drawings.submitted, drawings.culled);
+
+		if (ImGui::CollapsingHeader("Profiler"))
+			mvProfiler::render();
+
 		if (ImGui::IsWindowFocused())
 		{
 
@@ -2,6 +2,7 @@
 #include "mvMarvel.h"
 #include "mvCore.h"
 #include "mvDataStorage.h"
+#include "mvTextureStorage.h"
 #include "mvInput.h"
 #include "mvTextEditor.h"
 #include "mvThemeScheme.h"
@@ -18,15 +19,40 @@
 #include <thread>
 #include <future>
 #include <chrono>
+#include <algorithm>
+#include <cstdio>
 #include "Core/mvThreadPool.h"
+#include "Core/mvProfiler.h"
+#include "mvWindow.h"
 #include "Core/AppItems/mvAppItems.h"
 #include <frameobject.h>
 
 namespace Marvel {
 
+	// in power saving mode, frames rendered after waking (so imgui can settle
+	// hover/active states) and the longest the viewport blocks for
+	static constexpr int    s_activeFrames = 3;
+	static constexpr double s_idleWait = 1.0;
+
 	mvApp* mvApp::s_instance = nullptr;
 	bool   mvApp::s_started = false;
 
+	// set once the callback cache is cleared on teardown, handlers destroyed
+	// after it (the app's own and the standard windows) have nothing to release
+	static bool s_callbacksCleared = false;
+
+	void RetainCallback(const std::string& name)
+	{
+		if (!name.empty() && !s_callbacksCleared)
+			mvApp::GetApp()->retainCallback(name);
+	}
+
+	void ReleaseCallback(const std::string& name)
+	{
+		if (!name.empty() && !s_callbacksCleared)
+			mvApp::GetApp()->releaseCallback(name);
+	}
+
 	mvApp* mvApp::GetApp()
 	{
 		if (s_instance)
@@ -66,9 +92,11 @@ namespace Marvel {
 #endif
 
 		m_mainThreadID = std::this_thread::get_id();
+		s_callbacksCleared = false;
 
 		m_windows.push_back(new mvWindowAppitem("", "MainWindow", 1280, 800, 0, 0, true, false, true, false, false));
 		m_parents.push(m_windows.back());
+		registerItem(m_windows.back());
 
 		addStandardWindow("documentation", mvDocWindow::GetWindow());
 		addStandardWindow("about", new mvAboutWindow());
@@ -82,12 +110,22 @@ namespace Marvel {
 
 	mvApp::~mvApp()
 	{
+		// release anything held by commands queued from worker threads
+		runCommands();
+		for (auto& newItem : m_newItemVec)
+			delete newItem.item;
+		m_newItemVec.clear();
+
 		for (auto window : m_windows)
 		{
 			delete window;
 			window = nullptr;
 		}
 		m_windows.clear();
+		m_itemRegistry.clear();
+		clearCallbacks();
+		clearCallbackCache();
+		s_callbacksCleared = true;
 
 		mvTextureStorage::DeleteAllTextures();
 		mvDataStorage::DeleteAllData();
@@ -127,10 +165,22 @@ namespace Marvel {
 
 	void mvApp::prerender()
 	{
+		MV_PROFILE_SCOPE("prerender");
 
 		if (m_firstRender)
 			firstRenderFrame();
 
+		// apply commands from worker threads
+		{
+			MV_PROFILE_SCOPE("commands");
+			runCommands();
+		}
+
+		releaseUnheldCallables();
+
+		// upload images decoded since the last frame
+		mvTextureStorage::UpdateTextures();
+
 		// check if threadpool is ready to be cleaned up
 		if (m_threadTime > m_threadPoolTimeout)
 		{
@@ -154,12 +204,22 @@ namespace Marvel {
 		// and are requesting to send data back to main thread
 		if (!m_asyncReturns.empty())
 		{
-			std::lock_guard<std::mutex> lock(m_mutex);
-			while (!m_asyncReturns.empty())
+			MV_PROFILE_SCOPE("async returns");
+
+			// workers push returns while holding the GIL, so the queue is
+			// taken before running the callbacks (which need the GIL)
+			std::queue<AsyncronousCallback> asyncReturns;
+			{
+				std::lock_guard<std::mutex> lock(m_mutex);
+				std::swap(asyncReturns, m_asyncReturns);
+			}
+
+			while (!asyncReturns.empty())
 			{
-				auto& asyncreturn = m_asyncReturns.front();
+				auto& asyncreturn = asyncReturns.front();
 				runReturnCallback(asyncreturn.name, "Asyncrounous Callback", asyncreturn.data);
-				m_asyncReturns.pop();
+				ReleaseCallback(asyncreturn.name);
+				asyncReturns.pop();
 			}
 		}
 
@@ -170,7 +230,10 @@ namespace Marvel {
 			updateStyle();
 
 		// route any registered input callbacks
-		routeInputCallbacks();
+		{
+			MV_PROFILE_SCOPE("input callbacks");
+			routeInputCallbacks();
+		}
 
 		// run render callbacks
 		if (m_activeWindow == "MainWindow")
@@ -194,6 +257,10 @@ namespace Marvel {
 			}
 		}
 
+		// send data stored this frame (and last frame's
+		// widget edits) to the items using it
+		mvDataStorage::UpdateData();
+
 		// resets app items states (i.e. hovered)
 		for (auto window : m_windows)
 			window->resetState();
@@ -202,28 +269,41 @@ namespace Marvel {
 
 	void mvApp::render(bool& show)
 	{
+		MV_PROFILE_SCOPE("render");
+
 		for (auto window : m_windows)
+		{
+			MV_PROFILE_SCOPE(window->getName());
 			window->draw();
+		}
 	}
 
 	void mvApp::postrender()
 	{
+		MV_PROFILE_SCOPE("postrender");
 
 		// render any standard windows (i.e. debug, etc.)
 		for (auto& entry : m_standardWindows)
 		{
 			if (entry.second.show)
+			{
+				MV_PROFILE_SCOPE(entry.first);
 				entry.second.window->render(entry.second.show);
+			}
 		}
 
-		Py_BEGIN_ALLOW_THREADS
+		MV_PROFILE_SCOPE("runtime items");
 
 		// delete items from the delete queue
 		while (!m_deleteChildrenQueue.empty())
 		{
 			auto item = getItem(m_deleteChildrenQueue.front());
 			if (item)
+			{
+				for (auto child : item->getChildren())
+					unregisterItem(child);
 				item->deleteChildren();
+			}
 			m_deleteChildrenQueue.pop();
 		}
 
@@ -232,45 +312,25 @@ namespace Marvel {
 		{
 			bool deletedItem = false;
 
-			// try to delete item
-			for (auto window : m_windows)
-			{
-				deletedItem = window->deleteChild(m_deleteQueue.front());
-				if (deletedItem)
-					break;
-			}
-
-			bool windowDeleting = false;
-
-			// check if attempting to delete a window
-			for (auto window : m_windows)
-			{
-				if (window->getName() == m_deleteQueue.front())
-				{
-					windowDeleting = true;
-					break;
-				}
-			}
+			mvAppItem* item = findItem(m_deleteQueue.front());
 
-			// delete window and update window vector
-			// this should be changed to a different data
-			// structure
-			if (windowDeleting)
+			if (item)
 			{
-				std::vector<mvAppItem*> oldwindows = m_windows;
+				unregisterItem(item);
 
-				m_windows.clear();
+				// windows are not owned by a parent
+				if (item->getParent())
+					deletedItem = item->getParent()->deleteChild(item);
 
-				for (auto window : oldwindows)
+				else
 				{
-					if (window->getName() == m_deleteQueue.front())
+					auto window = std::find(m_windows.begin(), m_windows.end(), item);
+					if (window != m_windows.end())
 					{
-						delete window;
-						window = nullptr;
+						m_windows.erase(window);
+						delete item;
 						deletedItem = true;
-						continue;
 					}
-					m_windows.push_back(window);
 				}
 			}
 
@@ -286,7 +346,7 @@ namespace Marvel {
 
 			bool addedItem = false;
 
-			if (getItem(newItem.item->getName(), true))
+			if (findItem(newItem.item->getName()))
 			{
 				std::string message = newItem.item->getName();
 				ThrowPythonException(message + ": Items of this type must have unique names");
@@ -298,17 +358,29 @@ namespace Marvel {
 			if (newItem.item->getType() == mvAppItemType::Window)
 			{
 				m_windows.push_back(newItem.item);
+				registerItem(newItem.item);
 				continue;
 			}
 
-			for (auto window : m_windows)
+			// the before item determines the container when specified
+			if (!newItem.before.empty())
 			{
-				addedItem = window->addRuntimeChild(newItem.parent, newItem.before, newItem.item);
-				if (addedItem)
-					break;
+				mvAppItem* before = findItem(newItem.before);
+				if (before && before->getParent())
+					addedItem = before->getParent()->addRuntimeChild(newItem.item, before);
 			}
 
-			if (!addedItem)
+			else
+			{
+				mvAppItem* parent = findItem(newItem.parent);
+				if (parent && parent->isContainer())
+					addedItem = parent->addRuntimeChild(newItem.item);
+			}
+
+			if (addedItem)
+				registerItem(newItem.item);
+
+			else
 			{
 				ThrowPythonException(newItem.item->getName() + " not added because its parent was not found");
 				delete newItem.item;
@@ -318,6 +390,7 @@ namespace Marvel {
 		}
 
 		m_newItemVec.clear();
+		m_newItemRegistry.clear();
 
 		// move items up
 		while (!m_upQueue.empty())
@@ -326,12 +399,9 @@ namespace Marvel {
 
 			bool movedItem = false;
 
-			for (auto window : m_windows)
-			{
-				movedItem = window->moveChildUp(itemname);
-				if (movedItem)
-					break;
-			}
+			mvAppItem* item = findItem(itemname);
+			if (item && item->getParent())
+				movedItem = item->getParent()->moveChildUp(item);
 
 			if (!movedItem)
 				ThrowPythonException(itemname + " not moved because it was not found");
@@ -346,12 +416,9 @@ namespace Marvel {
 
 			bool movedItem = false;
 
-			for (auto window : m_windows)
-			{
-				movedItem = window->moveChildDown(itemname);
-				if (movedItem)
-					break;
-			}
+			mvAppItem* item = findItem(itemname);
+			if (item && item->getParent())
+				movedItem = item->getParent()->moveChildDown(item);
 
 			if (!movedItem)
 				ThrowPythonException(itemname + " not moved because it was not found");
@@ -362,6 +429,8 @@ namespace Marvel {
 		// async callbacks
 		if (!m_asyncCallbacks.empty())
 		{
+			MV_PROFILE_SCOPE("async submit");
+
 			// check if threadpool is valid, if not, create it
 			if (m_tpool == nullptr)
 			{
@@ -372,19 +441,76 @@ namespace Marvel {
 			}
 
 
-			// submit to thread pool
+			// submit to thread pool, async functions may queue more from
+			// worker threads while this runs
+			std::lock_guard<std::mutex> lock(m_mutex);
 			for (auto& callback : m_asyncCallbacks)
 				m_tpool->submit(std::bind(&mvApp::runAsyncCallback, this, callback.name, callback.data, callback.returnname));
 
-			//std::lock_guard<std::mutex> lock(m_mutex);
 			m_asyncCallbacks.clear();
 		}
 
 		// update timer if thread pool exists
 		if (m_tpool != nullptr)
 			m_threadTime = std::chrono::duration_cast<second_>(clock_::now() - m_poolStart).count();
+	}
+
+	double mvApp::getEventWait()
+	{
+		if (!m_powerSaving)
+			return 0.0;
+
+		// work waiting for the next frame (the text cursor blinks while
+		// typing, so that counts too)
+		bool pending = m_redraw.exchange(false) || ImGui::GetIO().WantTextInput
+			|| !m_commandQueue.empty() || mvDataStorage::HasChanges() || mvTextureStorage::HasPendingUploads() || !m_newItemVec.empty() || !m_asyncCallbacks.empty()
+			|| !m_deleteQueue.empty() || !m_deleteChildrenQueue.empty() || !m_upQueue.empty() || !m_downQueue.empty();
+
+		if (!pending)
+		{
+			std::lock_guard<std::mutex> lock(m_mutex);
+			pending = !m_asyncReturns.empty();
+		}
+
+		if (pending)
+		{
+			m_activeFrames = s_activeFrames;
+			return 0.0;
+		}
 
-		Py_END_ALLOW_THREADS
+		if (m_activeFrames > 0)
+		{
+			m_activeFrames--;
+			return 0.0;
+		}
+
+		return s_idleWait;
+	}
+
+	void mvApp::endEventWait(bool woken)
+	{
+		// a timed out wait renders a single frame
+		if (woken)
+			m_activeFrames = s_activeFrames;
+	}
+
+	void mvApp::requestRedraw()
+	{
+		m_redraw = true;
+		if (m_viewport)
+			m_viewport->wakeup();
+	}
+
+	void mvApp::runCommands()
+	{
+		if (m_commandQueue.empty())
+			return;
+
+		mvGlobalIntepreterLock gil;
+
+		mvCommand command;
+		while (m_commandQueue.try_pop(command))
+			command();
 	}
 
 	void mvApp::setWindowSize(unsigned width, unsigned height)
@@ -428,6 +554,7 @@ namespace Marvel {
 	{
 		if (std::this_thread::get_id() != m_mainThreadID)
 		{
+			mvGlobalIntepreterLock gil;
 			int line = PyFrame_GetLineNumber(PyEval_GetFrame());
 			PyErr_Format(PyExc_Exception,
 				"DearPyGui command on line %d can not be called asycronously", line);
@@ -456,6 +583,10 @@ namespace Marvel {
 			}
 		}
 
+		// batched mode, every input event of the frame in a single callback
+		if (!eventHandler->getInputCallback().empty())
+			routeInputBatch(eventHandler->getInputCallback());
+
 		// early opt out of keyboard events
 		if (eventHandler->isKeyboardHandled())
 		{
@@ -534,17 +665,86 @@ namespace Marvel {
 		}
 	}
 
+	void mvApp::routeInputBatch(const std::string& callback)
+	{
+		ImGuiIO& io = ImGui::GetIO();
+
+		std::vector<int> keysPressed;
+		std::vector<int> keysReleased;
+		std::vector<std::pair<int, float>> keysDown;
+		for (int i = 0; i < IM_ARRAYSIZE(io.KeysDown); i++)
+		{
+			if (io.KeysDownDuration[i] >= 0.0f)
+			{
+				keysDown.emplace_back(i, io.KeysDownDuration[i]);
+				if (ImGui::IsKeyPressed(i))
+					keysPressed.push_back(i);
+			}
+			else if (ImGui::IsKeyReleased(i))
+				keysReleased.push_back(i);
+		}
+
+		std::vector<int> mouseClicked;
+		std::vector<int> mouseDoubleClicked;
+		std::vector<int> mouseReleased;
+		std::vector<std::pair<int, float>> mouseDown;
+		for (int i = 0; i < IM_ARRAYSIZE(io.MouseDown); i++)
+		{
+			if (io.MouseDownDuration[i] >= 0.0f)
+				mouseDown.emplace_back(i, io.MouseDownDuration[i]);
+			if (ImGui::IsMouseClicked(i))
+				mouseClicked.push_back(i);
+			if (ImGui::IsMouseDoubleClicked(i))
+				mouseDoubleClicked.push_back(i);
+			if (ImGui::IsMouseReleased(i))
+				mouseReleased.push_back(i);
+		}
+
+		// nothing happened this frame
+		if (keysDown.empty() && keysReleased.empty() && mouseDown.empty() && mouseReleased.empty() && io.MouseWheel == 0.0f)
+			return;
+
+		PyObject* batch;
+		{
+			mvGlobalIntepreterLock gil;
+
+			batch = PyDict_New();
+			auto setItem = [batch](const char* key, PyObject* value)
+			{
+				PyDict_SetItemString(batch, key, value);
+				Py_XDECREF(value);
+			};
+
+			setItem("keys_pressed", mvPythonTranslator::ToPyList(keysPressed));
+			setItem("keys_down", mvPythonTranslator::ToPyList(keysDown));
+			setItem("keys_released", mvPythonTranslator::ToPyList(keysReleased));
+			setItem("mouse_clicked", mvPythonTranslator::ToPyList(mouseClicked));
+			setItem("mouse_double_clicked", mvPythonTranslator::ToPyList(mouseDoubleClicked));
+			setItem("mouse_down", mvPythonTranslator::ToPyList(mouseDown));
+			setItem("mouse_released", mvPythonTranslator::ToPyList(mouseReleased));
+			setItem("mouse_wheel", PyFloat_FromDouble(io.MouseWheel));
+		}
+
+		runCallback(callback, m_activeWindow, batch);
+	}
+
 	void mvApp::addRuntimeItem(const std::string& parent, const std::string& before, mvAppItem* item) 
 	{ 
 		if (!checkIfMainThread())
 			return;
 
 		m_newItemVec.push_back({ item, before, parent });
+		m_newItemRegistry.emplace(item->getName(), item);
 	}
 
 	void mvApp::addMTCallback(const std::string& name, PyObject* data, const std::string& returnname) 
 	{ 
 		Py_XINCREF(data);
+
+		// released once each has run
+		RetainCallback(name);
+		RetainCallback(returnname);
+
 		std::lock_guard<std::mutex> lock(m_mutex);
 		m_asyncCallbacks.push_back({ name, data, returnname }); 
 	}
@@ -595,17 +795,7 @@ namespace Marvel {
 		if (item)
 			return item;
 
-		for (auto window : m_windows)
-		{
-			if (window->getName() == name)
-				return window;
-
-			auto child = window->getChild(name);
-			if (child)
-				return child;
-		}
-
-		return nullptr;
+		return findItem(name);
 	}
 
 	mvAppItem* mvApp::getRuntimeItem(const std::string& name)
@@ -613,12 +803,9 @@ namespace Marvel {
 		if (!checkIfMainThread())
 			return nullptr;
 
-		for (auto& item : m_newItemVec)
-		{
-
-			if (item.item->getName() == name)
-				return item.item;
-		}
+		auto item = m_newItemRegistry.find(name);
+		if (item != m_newItemRegistry.end())
+			return item->second;
 
 		return nullptr;
 	}
@@ -629,9 +816,7 @@ namespace Marvel {
 		if (!checkIfMainThread())
 			return nullptr;
 
-		mvAppItem* item = getRuntimeItem(name);
-		if (item == nullptr)
-			item = getItem(name);
+		mvAppItem* item = getItem(name);
 		if (item == nullptr)
 			return nullptr;
 
@@ -641,43 +826,69 @@ namespace Marvel {
 		return nullptr;
 	}
 
-	void mvApp::runAsyncCallback(std::string name, PyObject* data, std::string returnname)
+	mvAppItem* mvApp::findItem(const std::string& name) const
 	{
-		if (name.empty())
+		auto item = m_itemRegistry.find(name);
+		if (item != m_itemRegistry.end())
+			return item->second;
+
+		return nullptr;
+	}
+
+	void mvApp::registerItem(mvAppItem* item)
+	{
+		m_itemRegistry.emplace(item->getName(), item);
+
+		if (!item->getDataSource().empty())
+			mvDataStorage::Subscribe(item->getDataSource(), item);
+		if (!item->getSecondaryDataSource().empty())
+			mvDataStorage::Subscribe(item->getSecondaryDataSource(), item);
+
+		for (auto child : item->getChildren())
+			registerItem(child);
+	}
+
+	void mvApp::unregisterItem(mvAppItem* item)
+	{
+		for (auto child : item->getChildren())
+			unregisterItem(child);
+
+		if (!item->getDataSource().empty())
+			mvDataStorage::Unsubscribe(item->getDataSource(), item);
+		if (!item->getSecondaryDataSource().empty())
+			mvDataStorage::Unsubscribe(item->getSecondaryDataSource(), item);
+
+		auto range = m_itemRegistry.equal_range(item->getName());
+		for (auto it = range.first; it != range.second; ++it)
 		{
-			Py_XDECREF(data);
-			return;
+			if (it->second == item)
+			{
+				m_itemRegistry.erase(it);
+				break;
+			}
 		}
+	}
 
+	void mvApp::runAsyncCallback(std::string name, PyObject* data, std::string returnname)
+	{
 		mvGlobalIntepreterLock gil;
 
-		PyObject* pHandler = PyDict_GetItemString(PyModule_GetDict(PyImport_AddModule("__main__")), name.c_str()); // borrowed
-		if (pHandler == NULL)
+		if (name.empty())
 		{
-			PyObject* pModules = PyDict_Values(PyImport_GetModuleDict());
-			PyObject* pModulesKeys = PyDict_Keys(PyImport_GetModuleDict());
-			for (int i = 0; i < PyList_Size(pModules); i++)
-			{
-				//mvAppLog::LogError(_PyUnicode_AsString(PyList_GetItem(pModulesKeys, i)));
-				PyObject* pModule = PyModule_GetDict(PyList_GetItem(pModules, i));
-				if (PyDict_Check(pModule))
-				{
-					pHandler = PyDict_GetItemString(pModule, name.c_str()); // borrowed reference
-					if (pHandler)
-						break;
-				}
-
-			}
-			Py_XDECREF(pModules);
-			Py_XDECREF(pModulesKeys);
+			Py_XDECREF(data);
+			ReleaseCallback(returnname);
+			return;
 		}
 
+		PyObject* pHandler = resolveCallback(name); // borrowed
+
 		// if callback doesn't exist
 		if (pHandler == NULL)
 		{
 			std::string message(" Callback doesn't exist");
 			ThrowPythonException(name + message);
-			
+			ReleaseCallback(name);
+			ReleaseCallback(returnname);
 			return;
 		}
 
@@ -690,7 +901,10 @@ namespace Marvel {
 			PyTuple_SetItem(pArgs, 0, PyUnicode_FromString("Async"));
 			PyTuple_SetItem(pArgs, 1, data); // steals data, so don't deref
 
+			Py_INCREF(pHandler);
 			PyObject* result = PyObject_CallObject(pHandler, pArgs);
+			Py_DECREF(pHandler);
+			ReleaseCallback(name);
 
 			// check if call succeded
 			if (!result)
@@ -699,10 +913,14 @@ namespace Marvel {
 				ThrowPythonException(name + message);
 			}
 
+			// the return handler is released after it runs on the main thread
 			if (!returnname.empty())
 			{
-				std::lock_guard<std::mutex> lock(m_mutex);
-				m_asyncReturns.push({ returnname, result });
+				{
+					std::lock_guard<std::mutex> lock(m_mutex);
+					m_asyncReturns.push({ returnname, result });
+				}
+				requestRedraw();
 			}
 			else
 				Py_XDECREF(result);
@@ -719,12 +937,167 @@ namespace Marvel {
 		{
 			std::string message(" Callback not callable");
 			ThrowPythonException(name + message);
+			ReleaseCallback(name);
+			ReleaseCallback(returnname);
 		}
 
 	}
 
+	PyObject* mvApp::resolveCallback(const std::string& name)
+	{
+		auto cached = m_callbackCache.find(name);
+		if (cached != m_callbackCache.end())
+		{
+			// valid while the name is still bound to the same object
+			const CachedCallback& callback = cached->second;
+			if (callback.scope == nullptr || PyDict_GetItem(callback.scope, callback.key) == callback.callable)
+				return callback.callable;
+
+			invalidateCallback(name);
+		}
+
+		PyObject* key = PyUnicode_FromString(name.c_str());
+		if (key == nullptr)
+		{
+			PyErr_Clear();
+			return nullptr;
+		}
+
+		// search __main__ first, then every loaded module
+		PyObject* scope = PyModule_GetDict(PyImport_AddModule("__main__")); // borrowed
+		PyObject* callable = PyDict_GetItem(scope, key); // borrowed
+		if (callable == nullptr)
+		{
+			PyObject* moduleName;
+			PyObject* module;
+			Py_ssize_t position = 0;
+			while (PyDict_Next(PyImport_GetModuleDict(), &position, &moduleName, &module))
+			{
+				if (!PyModule_Check(module))
+					continue;
+
+				scope = PyModule_GetDict(module);
+				callable = PyDict_GetItem(scope, key);
+				if (callable)
+					break;
+			}
+		}
+
+		if (callable == nullptr)
+		{
+			Py_DECREF(key);
+			return nullptr;
+		}
+
+		Py_INCREF(callable);
+		Py_INCREF(scope);
+		m_callbackCache[name] = { callable, scope, key };
+		return callable;
+	}
+
+	PyObject* mvApp::registerCallable(PyObject* callable)
+	{
+		// named by identity so registering a callable again reuses its entry
+		char address[32];
+		snprintf(address, sizeof(address), "##%p", (void*)callable);
+
+		std::string name = "callable";
+		PyObject* qualname = PyObject_GetAttrString(callable, "__qualname__");
+		if (qualname && PyUnicode_Check(qualname))
+			name = _PyUnicode_AsString(qualname);
+		else
+			PyErr_Clear();
+		Py_XDECREF(qualname);
+		name += address;
+
+		auto cached = m_callbackCache.find(name);
+		if (cached != m_callbackCache.end())
+			return cached->second.key;
+
+		PyObject* key = PyUnicode_FromString(name.c_str());
+		Py_INCREF(callable);
+		m_callbackCache[name] = { callable, nullptr, key };
+
+		// only held once assigned, swept next frame if that never happens
+		m_unheldCallables.push_back(name);
+		m_unheldPending = true;
+		return key;
+	}
+
+	void mvApp::releaseUnheldCallables()
+	{
+		if (!m_unheldPending.exchange(false))
+			return;
+
+		mvGlobalIntepreterLock gil;
+
+		for (const auto& name : m_unheldCallables)
+		{
+			auto cached = m_callbackCache.find(name);
+			if (cached == m_callbackCache.end() || cached->second.scope != nullptr || cached->second.holders > 0)
+				continue;
+
+			Py_XDECREF(cached->second.callable);
+			Py_XDECREF(cached->second.key);
+			m_callbackCache.erase(cached);
+		}
+		m_unheldCallables.clear();
+	}
+
+	void mvApp::retainCallback(const std::string& name)
+	{
+		mvGlobalIntepreterLock gil;
+
+		auto cached = m_callbackCache.find(name);
+		if (cached != m_callbackCache.end() && cached->second.scope == nullptr)
+			cached->second.holders++;
+	}
+
+	void mvApp::releaseCallback(const std::string& name)
+	{
+		mvGlobalIntepreterLock gil;
+
+		auto cached = m_callbackCache.find(name);
+		if (cached == m_callbackCache.end() || cached->second.scope != nullptr || --cached->second.holders > 0)
+			return;
+
+		Py_XDECREF(cached->second.callable);
+		Py_XDECREF(cached->second.key);
+		m_callbackCache.erase(cached);
+	}
+
+	void mvApp::invalidateCallback(const std::string& name)
+	{
+		auto cached = m_callbackCache.find(name);
+
+		// registered callables can't go stale
+		if (cached == m_callbackCache.end() || cached->second.scope == nullptr)
+			return;
+
+		Py_XDECREF(cached->second.callable);
+		Py_XDECREF(cached->second.scope);
+		Py_XDECREF(cached->second.key);
+		m_callbackCache.erase(cached);
+	}
+
+	void mvApp::clearCallbackCache()
+	{
+		mvGlobalIntepreterLock gil;
+
+		for (auto& cached : m_callbackCache)
+		{
+			Py_XDECREF(cached.second.callable);
+			Py_XDECREF(cached.second.scope);
+			Py_XDECREF(cached.second.key);
+		}
+		m_callbackCache.clear();
+		m_unheldCallables.clear();
+	}
+
 	void mvApp::runReturnCallback(const std::string& name, const std::string& sender, PyObject* data)
 	{
+		mvGlobalIntepreterLock gil;
+
 		if (name.empty())
 		{
 			if (data != nullptr)
@@ -743,6 +1116,10 @@ namespace Marvel {
 
 	void mvApp::runCallback(const std::string& name, const std::string& sender, PyObject* data)
 	{
+		// the frame is built without the GIL, so it is taken here for the
+		// whole callback (including releasing data)
+		mvGlobalIntepreterLock gil;
+
 		if (name.empty())
 		{
 			if(data != nullptr)
@@ -756,27 +1133,9 @@ namespace Marvel {
 			Py_XINCREF(data);
 		}
 
-		mvGlobalIntepreterLock gil;
-
-		PyObject* pHandler = PyDict_GetItemString(PyModule_GetDict(PyImport_AddModule("__main__")), name.c_str()); // borrowed
-		if (pHandler == NULL)
-		{
-			PyObject* pModules = PyDict_Values(PyImport_GetModuleDict());
-			PyObject* pModulesKeys = PyDict_Keys(PyImport_GetModuleDict());
-			for (int i = 0; i < PyList_Size(pModules); i++)
-			{
-				PyObject* pModule = PyModule_GetDict(PyList_GetItem(pModules, i));
-				if (PyDict_Check(pModule))
-				{
-					pHandler = PyDict_GetItemString(pModule, name.c_str()); // borrowed reference
-					if (pHandler)
-						break;
-				}
+		MV_PROFILE_SCOPE(name);
 
-			}
-			Py_XDECREF(pModules);
-			Py_XDECREF(pModulesKeys);
-		}
+		PyObject* pHandler = resolveCallback(name); // borrowed
 
 		// if callback doesn't exist
 		if (pHandler == NULL)
@@ -796,7 +1155,10 @@ namespace Marvel {
 			PyTuple_SetItem(pArgs, 0, PyUnicode_FromString(sender.c_str()));
 			PyTuple_SetItem(pArgs, 1, data); // steals data, so don't deref
 
+			// the cache may drop its reference while the callback runs
+			Py_INCREF(pHandler);
 			PyObject* result = PyObject_CallObject(pHandler, pArgs);
+			Py_DECREF(pHandler);
 
 			// check if call succeded
 			if (!result)
@@ -1249,6 +1611,7 @@ namespace Marvel {
 
 		item->setParent(parentitem);
 		parentitem->addChild(item);
+		registerItem(item);
 	}
 
 	void mvApp::addWindow(mvAppItem* item)
@@ -1257,6 +1620,7 @@ namespace Marvel {
 			return;
 
 		m_windows.push_back(item);
+		registerItem(item);
 	}
 
 }
\ No newline at end of file
@@ -26,9 +26,11 @@ namespace Marvel {
 	unsigned mvAppLog::s_width = 500;
 	unsigned mvAppLog::s_height = 500;
 	ImGuiWindowFlags mvAppLog::s_flags = ImGuiWindowFlags_NoSavedSettings;
+	std::mutex       mvAppLog::s_mutex;
 
 	void mvAppLog::Clear()
 	{
+		std::lock_guard<std::mutex> lock(s_mutex);
 		Buf.clear();
 		LineOffsets.clear();
 		LineOffsets.push_back(0);
@@ -36,9 +38,7 @@ namespace Marvel {
 
 	void mvAppLog::AddLog(const char* fmt, ...)
 	{
-		static std::mutex mutex;
-
-		std::lock_guard<std::mutex> lock(mutex);
+		std::lock_guard<std::mutex> lock(s_mutex);
 
 		int old_size = Buf.size();
 		va_list args;
@@ -97,6 +97,9 @@ namespace Marvel {
 		if (copy)
 			ImGui::LogToClipboard();
 
+		// worker threads may log while the frame is built
+		std::unique_lock<std::mutex> lock(s_mutex);
+
 		ImGui::PushStyleVar(ImGuiStyleVar_ItemSpacing, ImVec2(0, 0));
 		const char* buf = Buf.begin();
 		const char* buf_end = Buf.end();
@@ -168,6 +171,8 @@ namespace Marvel {
 		}
 		ImGui::PopStyleVar();
 
+		lock.unlock();
+
 		if (AutoScroll && ImGui::GetScrollY() >= ImGui::GetScrollMaxY())
 			ImGui::SetScrollHereY(1.0f);
 
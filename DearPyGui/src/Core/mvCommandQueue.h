@@ -0,0 +1,85 @@
+#pragma once
+
+//-----------------------------------------------------------------------------
+// mvCommandQueue
+//
+//     - Lock-free multi producer/single consumer queue of commands. Any
+//       thread may push, only the main thread pops (once per frame).
+//
+//-----------------------------------------------------------------------------
+
+#include <atomic>
+#include <functional>
+
+namespace Marvel {
+
+    typedef std::function<void()> mvCommand;
+
+    class mvCommandQueue
+    {
+
+        struct node
+        {
+            std::atomic<node*> next{ nullptr };
+            mvCommand          command;
+        };
+
+    public:
+
+        // the consumer always keeps one (already consumed) node around
+        mvCommandQueue() : m_head(new node), m_tail(m_head.load()) {}
+
+        ~mvCommandQueue()
+        {
+            while (m_tail)
+            {
+                node* next = m_tail->next.load(std::memory_order_relaxed);
+                delete m_tail;
+                m_tail = next;
+            }
+        }
+
+        // copy assignment and constructor deleted
+        mvCommandQueue(const mvCommandQueue& other) = delete;
+        mvCommandQueue& operator=(const mvCommandQueue& other) = delete;
+
+        // safe from any thread
+        void push(mvCommand command)
+        {
+            node* n = new node;
+            n->command = std::move(command);
+
+            // producers only contend on this exchange, the link to the
+            // previous node is published afterwards
+            node* prev = m_head.exchange(n, std::memory_order_acq_rel);
+            prev->next.store(n, std::memory_order_release);
+        }
+
+        // consumer only. A command whose producer is between the exchange
+        // and the link above is picked up on the next call.
+        bool try_pop(mvCommand& command)
+        {
+            node* next = m_tail->next.load(std::memory_order_acquire);
+            if (next == nullptr)
+                return false;
+
+            command = std::move(next->command);
+            delete m_tail;
+            m_tail = next;
+            return true;
+        }
+
+        // consumer only
+        bool empty() const
+        {
+            return m_tail->next.load(std::memory_order_acquire) == nullptr;
+        }
+
+    private:
+
+        std::atomic<node*> m_head; // last pushed
+        node*              m_tail; // last consumed
+
+    };
+
+}
@@ -2,25 +2,143 @@
 #include "mvApp.h"
 #include "mvAppLog.h"
 #include <thread>
+#include <algorithm>
+#include "mvPythonTranslator.h"
 #include "Core/mvPythonExceptions.h"
+#include "Core/mvProfiler.h"
 
 namespace Marvel {
 
-	std::map<std::string, PyObject*> mvDataStorage::s_dataStorage;
+	std::map<std::string, mvDataStorage::Entry>              mvDataStorage::s_dataStorage;
+	std::unordered_map<std::string, std::vector<mvAppItem*>> mvDataStorage::s_subscribers;
+	std::unordered_set<std::string>                          mvDataStorage::s_changed;
+
+	// GIL must be held
+	static mvDataValue ToDataValue(PyObject* data)
+	{
+		mvDataValue value;
+
+		if (data == nullptr)
+			return value;
+
+		if (PyBool_Check(data))
+		{
+			value.type = mvDataType::Bool;
+			value.ints.push_back(data == Py_True);
+		}
+
+		else if (PyLong_Check(data))
+		{
+			value.type = mvDataType::Int;
+			value.ints.push_back(mvPythonTranslator::ToInt(data));
+		}
+
+		else if (PyFloat_Check(data))
+		{
+			value.type = mvDataType::Float;
+			value.floats.push_back(mvPythonTranslator::ToFloat(data));
+		}
+
+		else if (PyUnicode_Check(data))
+		{
+			value.type = mvDataType::String;
+			value.strings.push_back(mvPythonTranslator::ToString(data));
+		}
+
+		else if (PyList_Check(data) || PyTuple_Check(data))
+		{
+			Py_ssize_t size = PySequence_Size(data);
+			if (size == 0)
+				return value;
+
+			bool ints = true;
+			bool numbers = true;
+			bool strings = true;
+			for (Py_ssize_t i = 0; i < size; i++)
+			{
+				PyObject* item = PyList_Check(data) ? PyList_GetItem(data, i) : PyTuple_GetItem(data, i);
+				bool isInt = PyLong_Check(item);
+				ints = ints && isInt;
+				numbers = numbers && (isInt || PyFloat_Check(item));
+				strings = strings && PyUnicode_Check(item);
+			}
+
+			if (ints)
+			{
+				value.type = mvDataType::IntList;
+				value.ints = mvPythonTranslator::ToIntVect(data);
+			}
+
+			else if (numbers)
+			{
+				value.type = mvDataType::FloatList;
+				value.floats = mvPythonTranslator::ToFloatVect(data);
+			}
+
+			else if (strings)
+			{
+				value.type = mvDataType::StringList;
+				value.strings = mvPythonTranslator::ToStringVect(data);
+			}
+		}
+
+		// numpy arrays, array.array, etc. Anything else (strided, object or
+		// structured arrays) is kept as an object
+		else if (PyObject_CheckBuffer(data))
+		{
+			if (mvPythonTranslator::BufferToFloatVect(data, value.floats))
+				value.type = mvDataType::FloatList;
+		}
+
+		return value;
+	}
+
+	// GIL must be held
+	static PyObject* ToPyObject(const mvDataValue& value)
+	{
+		switch (value.type)
+		{
+		case mvDataType::Bool:       return mvPythonTranslator::ToPyBool(value.ints[0] != 0);
+		case mvDataType::Int:        return mvPythonTranslator::ToPyInt(value.ints[0]);
+		case mvDataType::Float:      return mvPythonTranslator::ToPyFloat(value.floats[0]);
+		case mvDataType::String:     return mvPythonTranslator::ToPyString(value.strings[0]);
+		case mvDataType::IntList:    return mvPythonTranslator::ToPyList(value.ints);
+		case mvDataType::FloatList:  return mvPythonTranslator::ToPyList(value.floats);
+		case mvDataType::StringList: return mvPythonTranslator::ToPyList(value.strings);
+		default:                     return mvPythonTranslator::GetPyNone();
+		}
+	}
 
 	void mvDataStorage::DeleteAllData()
 	{
+		mvGlobalIntepreterLock gil;
+
 		for (auto& data : s_dataStorage)
-			Py_XDECREF(data.second);
+			Py_XDECREF(data.second.object);
 		s_dataStorage.clear();
+		s_subscribers.clear();
+		s_changed.clear();
 	}
 
 	void mvDataStorage::UpdateData()
 	{
-		for (auto& data : s_dataStorage)
+		if (s_changed.empty())
+			return;
+
+		MV_PROFILE_SCOPE("data storage update");
+
+		// items may store data while being updated, that is sent next frame
+		std::unordered_set<std::string> changed;
+		std::swap(changed, s_changed);
+
+		for (auto& name : changed)
 		{
-			for (auto window : mvApp::GetApp()->getWindows())
-				window->updateDataSource(data.first);
+			auto subscribers = s_subscribers.find(name);
+			if (subscribers == s_subscribers.end())
+				continue;
+
+			for (auto item : subscribers->second)
+				item->updateDataSource(name);
 		}
 	}
 
@@ -30,23 +148,35 @@ namespace Marvel {
 		if (!mvApp::GetApp()->checkIfMainThread())
 			return;
 
-		// data already exists, decrement it recursively until all old objects
-		// are delete then update everything with the new pyobjects (i think)
-		// this system needs to be cleaned up to be less confusing
-		if (s_dataStorage.count(name) > 0)
-		{
-			DeleteData(name);
-			AddData(name, data);
-			for (auto window : mvApp::GetApp()->getWindows())
-				window->updateDataSource(name);
+		mvGlobalIntepreterLock gil;
+
+		// the object is kept, so get_data returns what was stored
+		Entry& entry = s_dataStorage[name];
+		Py_XDECREF(entry.object);
+		entry.object = data;
+		entry.value = ToDataValue(data);
+
+		// subscribers are updated once per frame (in UpdateData)
+		s_changed.insert(name);
+	}
+
+	void mvDataStorage::AddData(const std::string& name, mvDataValue value)
+	{
+		if (!mvApp::GetApp()->checkIfMainThread())
 			return;
-		}
 
-		// data doesn't exist, create it for the first time
-		s_dataStorage.insert({ name, data });
+		Entry& entry = s_dataStorage[name];
 
-		for (auto window : mvApp::GetApp()->getWindows())
-			window->updateDataSource(name);
+		// the old object no longer matches
+		if (entry.object)
+		{
+			mvGlobalIntepreterLock gil;
+			Py_DECREF(entry.object);
+			entry.object = nullptr;
+		}
+
+		entry.value = std::move(value);
+		s_changed.insert(name);
 	}
 
 	void mvDataStorage::DeleteData(const std::string& name)
@@ -54,14 +184,18 @@ namespace Marvel {
 		if (!mvApp::GetApp()->checkIfMainThread())
 			return;
 
-		if (s_dataStorage.count(name) == 0)
+		mvGlobalIntepreterLock gil;
+
+		auto entry = s_dataStorage.find(name);
+		if (entry == s_dataStorage.end())
 		{
 			ThrowPythonException(name + " does not exists in data storage.");
 			return;
 		}
 
-		Py_XDECREF(s_dataStorage.at(name));
-		s_dataStorage.erase(name);
+		Py_XDECREF(entry->second.object);
+		s_dataStorage.erase(entry);
+		s_changed.erase(name);
 	}
 
 	PyObject* mvDataStorage::GetData(const std::string& name)
@@ -69,13 +203,29 @@ namespace Marvel {
 		if (!mvApp::GetApp()->checkIfMainThread())
 			return nullptr;
 
-		if (s_dataStorage.count(name) == 0)
+		mvGlobalIntepreterLock gil;
+
+		auto entry = s_dataStorage.find(name);
+		if (entry == s_dataStorage.end())
 		{
 			ThrowPythonException(name + " does not exists in data storage.");
 			return nullptr;
 		}
-		Py_XINCREF(s_dataStorage.at(name));
-		return s_dataStorage.at(name);
+
+		if (entry->second.object == nullptr)
+			entry->second.object = ToPyObject(entry->second.value);
+
+		Py_XINCREF(entry->second.object);
+		return entry->second.object;
+	}
+
+	const mvDataValue* mvDataStorage::GetValue(const std::string& name)
+	{
+		auto entry = s_dataStorage.find(name);
+		if (entry == s_dataStorage.end())
+			return nullptr;
+
+		return &entry->second.value;
 	}
 
 	unsigned  mvDataStorage::GetDataCount()
@@ -83,4 +233,25 @@ namespace Marvel {
 		return s_dataStorage.size();
 	}
 
+	void mvDataStorage::Subscribe(const std::string& name, mvAppItem* item)
+	{
+		s_subscribers[name].push_back(item);
+
+		// items added after their data was stored still receive it
+		if (s_dataStorage.count(name) > 0)
+			s_changed.insert(name);
+	}
+
+	void mvDataStorage::Unsubscribe(const std::string& name, mvAppItem* item)
+	{
+		auto subscribers = s_subscribers.find(name);
+		if (subscribers == s_subscribers.end())
+			return;
+
+		auto& items = subscribers->second;
+		items.erase(std::remove(items.begin(), items.end(), item), items.end());
+		if (items.empty())
+			s_subscribers.erase(subscribers);
+	}
+
 }
\ No newline at end of file
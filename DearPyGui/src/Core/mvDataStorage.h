@@ -11,42 +11,89 @@
 //         * Allows the user to store data for any other purpose where
 //           the data can be retrieved at a later time.
 //
-//     - AddData is also used to update existing data. We probably need to add
-//       an UpdataData method to make this explicit and come up with another
-//       name for the current UpdateData method. The current UpdateData just
-//       updates all items in mvApp (which should not be this class's
-//       responsibility).
+//     - AddData is also used to update existing data. Changes are batched,
+//       UpdateData is called once per frame and only notifies the items
+//       subscribed to data that changed since the last call.
+//
+//     - mvApp subscribes items to their data sources (primary and
+//       secondary) when they are registered and unsubscribes them when
+//       they are removed.
+//
+//     - Data is converted to a native value once when stored and read by
+//       all subscribers from there. Python objects are only created when
+//       data stored natively (i.e. by a widget) is requested with GetData.
 //     
 //-----------------------------------------------------------------------------
 
 #include <string>
 #include <map>
+#include <vector>
+#include <unordered_map>
+#include <unordered_set>
 #define PY_SSIZE_T_CLEAN
 #include <Python.h>
 
 namespace Marvel {
 
+	class mvAppItem;
+
+	enum class mvDataType
+	{
+		Object, // anything else, only kept as a python object
+		Bool, Int, Float, String,
+		IntList, FloatList, StringList
+	};
+
+	//-----------------------------------------------------------------------------
+	// mvDataValue
+	//     - Only the member for the type is used. Scalars are stored as a
+	//       single element. Numeric buffers (i.e. numpy arrays) are stored
+	//       as float lists.
+	//-----------------------------------------------------------------------------
+	struct mvDataValue
+	{
+		mvDataType               type = mvDataType::Object;
+		std::vector<int>         ints;    // Bool, Int, IntList
+		std::vector<float>       floats;  // Float, FloatList
+		std::vector<std::string> strings; // String, StringList
+	};
+
 	//-----------------------------------------------------------------------------
 	// mvDataStorage
 	//-----------------------------------------------------------------------------
 	class mvDataStorage
 	{
 
+		struct Entry
+		{
+			mvDataValue value;
+			PyObject*   object = nullptr; // created on demand for native values
+		};
+
 	public:
 
-		static void      AddData      (const std::string& name, PyObject* data);
-		static void      DeleteData   (const std::string& name);
-		static void      UpdateData   ();
-		static PyObject* GetData      (const std::string& name);
-		static unsigned  GetDataCount ();
-		static void      DeleteAllData();
+		static void               AddData      (const std::string& name, PyObject* data); // steals data
+		static void               AddData      (const std::string& name, mvDataValue value);
+		static void               DeleteData   (const std::string& name);
+		static void               UpdateData   (); // notifies subscribers of changed data
+		static PyObject*          GetData      (const std::string& name); // new reference
+		static const mvDataValue* GetValue     (const std::string& name); // nullptr if not stored
+		static unsigned           GetDataCount ();
+		static bool               HasChanges   () { return !s_changed.empty(); }
+		static void               DeleteAllData();
+
+		// items are notified through mvAppItem::updateDataSource
+		static void               Subscribe    (const std::string& name, mvAppItem* item);
+		static void               Unsubscribe  (const std::string& name, mvAppItem* item);
 
 	private:
 
 		mvDataStorage() = default;
 
-		static std::map<std::string, PyObject*> s_dataStorage;
+		static std::map<std::string, Entry>                             s_dataStorage;
+		static std::unordered_map<std::string, std::vector<mvAppItem*>> s_subscribers;
+		static std::unordered_set<std::string>                          s_changed; // since the last UpdateData
 
 	};
 
-}
\ No newline at end of file
+}
@@ -2,6 +2,7 @@
 #include "mvApp.h"
 #include "Core/mvInput.h"
 #include "Core/mvDataStorage.h"
+#include "Core/mvTextureStorage.h"
 #include "mvAppLog.h"
 #include "Core/StandardWindows/mvSourceWindow.h"
 #include "Core/StandardWindows/mvFileDialog.h"
@@ -9,7 +10,10 @@
 #include "Core/AppItems/mvAppItems.h"
 #include "mvWindow.h"
 #include "Core/mvPythonExceptions.h"
+#include "Core/mvProfiler.h"
 #include <ImGuiFileDialog.h>
+#include <limits>
+#include <algorithm>
 
 //-----------------------------------------------------------------------------
 // Helper Macro
@@ -18,6 +22,37 @@
 
 namespace Marvel {
 
+	static void SetItemValue(const std::string& name, PyObject* value)
+	{
+		mvAppItem* item = mvApp::GetApp()->getItem(name);
+
+		if (item == nullptr)
+			return;
+
+		item->setPyValue(value);
+
+		// other items using the data source are updated at the end of
+		// the frame's callbacks
+		if (!item->getDataSource().empty())
+		{
+			// the storage keeps a reference, same as add_data
+			mvDataStorage::AddData(item->getDataSource(), value);
+			Py_XINCREF(value);
+		}
+	}
+
+	// the parent stack belongs to the main thread, container commands can't
+	// be queued from worker threads like other items since the items added
+	// after them depend on the stack
+	static bool CheckParentStackAccess(const char* command)
+	{
+		if (mvApp::GetApp()->isMainThread())
+			return true;
+
+		ThrowPythonException(std::string(command) + " uses the parent stack and can't be called from an async function. Use the parent keyword instead.");
+		return false;
+	}
+
 	static void AddItemWithRuntimeChecks(mvAppItem* item, const char* parent, const char* before)
 	{
 
@@ -26,6 +61,16 @@ namespace Marvel {
 
 		auto ma = mvApp::GetApp();
 
+		// worker threads can't touch the item tree, added next frame instead
+		if (!ma->isMainThread())
+		{
+			std::string parentName = parent;
+			std::string beforeName = before;
+			ma->submitCommand([item, parentName, beforeName]() {
+				AddItemWithRuntimeChecks(item, parentName.c_str(), beforeName.c_str()); });
+			return;
+		}
+
 		// remove bad parent stack item
 		if (item->getType() == mvAppItemType::Window && ma->topParent() != nullptr)
 		{
@@ -817,7 +862,11 @@ namespace Marvel {
 	{
 
 		auto window = mvApp::GetApp()->getViewport();
+
+		// may wait for events in power saving mode
+		Py_BEGIN_ALLOW_THREADS
 		window->renderFrame();
+		Py_END_ALLOW_THREADS
 
 		return mvPythonTranslator::GetPyNone();
 	}
@@ -825,9 +874,11 @@ namespace Marvel {
 	PyObject* cleanup_dearpygui(PyObject* self, PyObject* args, PyObject* kwargs)
 	{
 
+		// textures belong to the viewport's graphics device
 		auto window = mvApp::GetApp()->getViewport();
-		delete window;
 		mvApp::GetApp()->setViewport(nullptr);
+		mvTextureStorage::DeleteAllTextures();
+		delete window;
 		mvApp::DeleteApp();
 
 		return mvPythonTranslator::GetPyNone();
@@ -843,7 +894,16 @@ namespace Marvel {
 		auto window = mvWindow::CreatemvWindow(mvApp::GetApp()->getActualWidth(), mvApp::GetApp()->getActualHeight());
 		mvApp::GetApp()->setViewport(window);
 		window->show();
+
+		// the frame is built and submitted without the GIL, it is only
+		// taken for callbacks and python objects so other threads can run
+		Py_BEGIN_ALLOW_THREADS
 		window->run();
+		Py_END_ALLOW_THREADS
+
+		// textures belong to the viewport's graphics device
+		mvApp::GetApp()->setViewport(nullptr);
+		mvTextureStorage::DeleteAllTextures();
 		delete window;
 		mvApp::DeleteApp();
 
@@ -858,7 +918,11 @@ namespace Marvel {
 		// create window
 		auto window = mvWindow::CreatemvWindow(mvApp::GetApp()->getActualWidth(), mvApp::GetApp()->getActualHeight(), true);
 		window->show();
+
+		Py_BEGIN_ALLOW_THREADS
 		window->run();
+		Py_END_ALLOW_THREADS
+		mvTextureStorage::DeleteAllTextures();
 		delete window;
 		mvApp::DeleteApp();
 
@@ -871,7 +935,11 @@ namespace Marvel {
 		// create window
 		auto window = mvWindow::CreatemvWindow(mvApp::GetApp()->getActualWidth(), mvApp::GetApp()->getActualHeight(), false, false, true);
 		window->show();
+
+		Py_BEGIN_ALLOW_THREADS
 		window->run();
+		Py_END_ALLOW_THREADS
+		mvTextureStorage::DeleteAllTextures();
 		delete window;
 		delete mvApp::GetApp();
 
@@ -1516,6 +1584,164 @@ namespace Marvel {
 		return mvPythonTranslator::GetPyNone();
 	}
 
+	static mvDrawing* GetDrawing(const char* drawing)
+	{
+		auto item = mvApp::GetApp()->getItem(drawing);
+
+		if (item == nullptr)
+		{
+			std::string message = drawing;
+			ThrowPythonException(message + " drawing does not exist.");
+			return nullptr;
+		}
+
+		if (item->getType() != mvAppItemType::Drawing)
+		{
+			ThrowPythonException(std::string(drawing) + " is not a drawing.");
+			return nullptr;
+		}
+
+		return static_cast<mvDrawing*>(item);
+	}
+
+	// packed RGBA colors, one for every primitive or one per primitive
+	static bool GetBatchColors(const char* command, const char* name, PyObject* value, size_t count, std::vector<ImU32>& colors)
+	{
+		std::vector<float> components = mvPythonTranslator::ToFloatVect(value);
+		if (components.size() != 4 && components.size() != count * 4)
+		{
+			ThrowPythonException(std::string(command) + " " + name + " must be one RGBA color or one per primitive.");
+			return false;
+		}
+
+		colors.resize(components.size() / 4);
+		for (size_t i = 0; i < colors.size(); i++)
+		{
+			const float* color = &components[i * 4];
+			colors[i] = IM_COL32(
+				std::clamp((int)color[0], 0, 255), std::clamp((int)color[1], 0, 255),
+				std::clamp((int)color[2], 0, 255), std::clamp((int)color[3], 0, 255));
+		}
+
+		return true;
+	}
+
+	PyObject* draw_circles(PyObject* self, PyObject* args, PyObject* kwargs)
+	{
+		const char* drawing;
+		PyObject* centers;
+		PyObject* radii;
+		PyObject* colors;
+		int segments = 12;
+		float thickness = 1.0f;
+		PyObject* fills = nullptr;
+		const char* tag = "";
+
+		if (!(*mvApp::GetApp()->getParsers())["draw_circles"].parse(args, kwargs, __FUNCTION__, &drawing, &centers, &radii, &colors, &segments, &thickness, &fills, &tag))
+			return mvPythonTranslator::GetPyNone();
+
+		mvDrawing* dwg = GetDrawing(drawing);
+		if (dwg == nullptr)
+			return mvPythonTranslator::GetPyNone();
+
+		std::vector<float> mcenters = mvPythonTranslator::ToFloatVect(centers);
+		std::vector<float> mradii = mvPythonTranslator::ToFloatVect(radii);
+		size_t count = mcenters.size() / 2;
+
+		if (mcenters.size() % 2 != 0)
+		{
+			ThrowPythonException("draw_circles centers must be packed x, y pairs.");
+			return mvPythonTranslator::GetPyNone();
+		}
+
+		if (mradii.size() != 1 && mradii.size() != count)
+		{
+			ThrowPythonException("draw_circles radii must be one radius or one per circle.");
+			return mvPythonTranslator::GetPyNone();
+		}
+
+		std::vector<ImU32> mcolors;
+		std::vector<ImU32> mfills;
+		if (!GetBatchColors("draw_circles", "colors", colors, count, mcolors))
+			return mvPythonTranslator::GetPyNone();
+		if (fills && !GetBatchColors("draw_circles", "fills", fills, count, mfills))
+			return mvPythonTranslator::GetPyNone();
+
+		dwg->drawCircles(std::move(mcenters), std::move(mradii), std::move(mcolors), std::move(mfills), segments, thickness, tag);
+
+		return mvPythonTranslator::GetPyNone();
+	}
+
+	PyObject* draw_lines(PyObject* self, PyObject* args, PyObject* kwargs)
+	{
+		const char* drawing;
+		PyObject* points;
+		PyObject* colors;
+		float thickness = 1.0f;
+		const char* tag = "";
+
+		if (!(*mvApp::GetApp()->getParsers())["draw_lines"].parse(args, kwargs, __FUNCTION__, &drawing, &points, &colors, &thickness, &tag))
+			return mvPythonTranslator::GetPyNone();
+
+		mvDrawing* dwg = GetDrawing(drawing);
+		if (dwg == nullptr)
+			return mvPythonTranslator::GetPyNone();
+
+		std::vector<float> mpoints = mvPythonTranslator::ToFloatVect(points);
+
+		if (mpoints.size() % 4 != 0)
+		{
+			ThrowPythonException("draw_lines points must be packed x1, y1, x2, y2 per line.");
+			return mvPythonTranslator::GetPyNone();
+		}
+
+		std::vector<ImU32> mcolors;
+		if (!GetBatchColors("draw_lines", "colors", colors, mpoints.size() / 4, mcolors))
+			return mvPythonTranslator::GetPyNone();
+
+		dwg->drawLines(std::move(mpoints), std::move(mcolors), thickness, tag);
+
+		return mvPythonTranslator::GetPyNone();
+	}
+
+	PyObject* draw_rectangles(PyObject* self, PyObject* args, PyObject* kwargs)
+	{
+		const char* drawing;
+		PyObject* points;
+		PyObject* colors;
+		PyObject* fills = nullptr;
+		float rounding = 0.0f;
+		float thickness = 1.0f;
+		const char* tag = "";
+
+		if (!(*mvApp::GetApp()->getParsers())["draw_rectangles"].parse(args, kwargs, __FUNCTION__, &drawing, &points, &colors, &fills, &rounding, &thickness, &tag))
+			return mvPythonTranslator::GetPyNone();
+
+		mvDrawing* dwg = GetDrawing(drawing);
+		if (dwg == nullptr)
+			return mvPythonTranslator::GetPyNone();
+
+		std::vector<float> mpoints = mvPythonTranslator::ToFloatVect(points);
+		size_t count = mpoints.size() / 4;
+
+		if (mpoints.size() % 4 != 0)
+		{
+			ThrowPythonException("draw_rectangles points must be packed xmin, ymin, xmax, ymax per rectangle.");
+			return mvPythonTranslator::GetPyNone();
+		}
+
+		std::vector<ImU32> mcolors;
+		std::vector<ImU32> mfills;
+		if (!GetBatchColors("draw_rectangles", "colors", colors, count, mcolors))
+			return mvPythonTranslator::GetPyNone();
+		if (fills && !GetBatchColors("draw_rectangles", "fills", fills, count, mfills))
+			return mvPythonTranslator::GetPyNone();
+
+		dwg->drawRectangles(std::move(mpoints), std::move(mcolors), std::move(mfills), rounding, thickness, tag);
+
+		return mvPythonTranslator::GetPyNone();
+	}
+
 	PyObject* clear_drawing(PyObject* self, PyObject* args, PyObject* kwargs)
 	{
 		const char* drawing;
@@ -1545,6 +1771,38 @@ namespace Marvel {
 		return mvPythonTranslator::GetPyNone();
 	}
 
+	PyObject* delete_draw_command(PyObject* self, PyObject* args, PyObject* kwargs)
+	{
+		const char* drawing;
+		const char* tag;
+
+		if (!(*mvApp::GetApp()->getParsers())["delete_draw_command"].parse(args, kwargs, __FUNCTION__, &drawing, &tag))
+			return mvPythonTranslator::GetPyNone();
+
+		auto item = mvApp::GetApp()->getItem(drawing);
+
+		if (item == nullptr)
+		{
+			std::string message = drawing;
+			ThrowPythonException(message + " drawing does not exist.");
+			return mvPythonTranslator::GetPyNone();
+		}
+
+		mvDrawing* dwg;
+		if (item->getType() == mvAppItemType::Drawing)
+			dwg = static_cast<mvDrawing*>(item);
+		else
+		{
+			ThrowPythonException(std::string(drawing) + " is not a drawing.");
+			return mvPythonTranslator::GetPyNone();
+		}
+
+		if (!dwg->deleteCommand(tag))
+			ThrowPythonException(std::string(tag) + " drawing command does not exist in " + drawing + ".");
+
+		return mvPythonTranslator::GetPyNone();
+	}
+
 	PyObject* clear_plot(PyObject* self, PyObject* args, PyObject* kwargs)
 	{
 		const char* plot;
@@ -1943,11 +2201,57 @@ namespace Marvel {
 		return mvPythonTranslator::GetPyNone();
 	}
 
+	// x/y keywords (lists or buffer protocol objects) take precedence
+	// over the list of [x, y] points
+	static bool GetSeriesData(const std::string& plot, const char* command, PyObject* data,
+		PyObject* x, PyObject* y, std::vector<float>& xs, std::vector<float>& ys)
+	{
+		if (x != nullptr && y != nullptr)
+		{
+			bool xvalid = false;
+			bool yvalid = false;
+			xs = mvPythonTranslator::ToFloatVect(x, "Type must be a list or tuple of floats.", &xvalid);
+			ys = mvPythonTranslator::ToFloatVect(y, "Type must be a list or tuple of floats.", &yvalid);
+
+			// the error has been reported
+			if (!xvalid || !yvalid)
+				return false;
+
+			if (xs.size() != ys.size())
+			{
+				ThrowPythonException(plot + " " + command + " requires x and y to be the same length.");
+				return false;
+			}
+
+			return true;
+		}
+
+		if (data == nullptr || !PyList_Check(data))
+		{
+			ThrowPythonException(plot + " " + command + " requires a list of lists or x and y keywords.");
+			return false;
+		}
+
+		auto datapoints = mvPythonTranslator::ToVectVec2(data);
+		xs.reserve(datapoints.size());
+		ys.reserve(datapoints.size());
+		for (auto& point : datapoints)
+		{
+			xs.push_back(point.x);
+			ys.push_back(point.y);
+		}
+
+		return true;
+	}
+
 	PyObject* add_line_series(PyObject* self, PyObject* args, PyObject* kwargs)
 	{
 		const char* plot;
 		const char* name;
-		PyObject* data;
+		PyObject* data = nullptr;
+		PyObject* x = nullptr;
+		PyObject* y = nullptr;
+		int capacity = 0;
 		float weight = 1.0f;
 		PyObject* color = PyTuple_New(4);
 		PyTuple_SetItem(color, 0, PyLong_FromLong(1000));
@@ -1961,16 +2265,9 @@ namespace Marvel {
 		PyTuple_SetItem(fill, 2, PyLong_FromLong(0));
 		PyTuple_SetItem(fill, 3, PyLong_FromLong(255));
 
-		if (!(*mvApp::GetApp()->getParsers())["add_line_series"].parse(args, kwargs, __FUNCTION__, &plot, &name, &data, &color, &fill, &weight))
+		if (!(*mvApp::GetApp()->getParsers())["add_line_series"].parse(args, kwargs, __FUNCTION__, &plot, &name, &data, &color, &fill, &weight, &x, &y, &capacity))
 			return mvPythonTranslator::GetPyNone();
 
-		if (!PyList_Check(data))
-		{
-			std::string message = plot;
-			ThrowPythonException(message + " add line series requires a list of lists.");
-			return mvPythonTranslator::GetPyNone();
-		}
-
 		mvAppItem* aplot = mvApp::GetApp()->getItem(plot);
 
 		if (aplot == nullptr)
@@ -1989,7 +2286,10 @@ namespace Marvel {
 
 		mvPlot* graph = static_cast<mvPlot*>(aplot);
 
-		auto datapoints = mvPythonTranslator::ToVectVec2(data);
+		std::vector<float> xs;
+		std::vector<float> ys;
+		if (!GetSeriesData(plot, "add line series", data, x, y, xs, ys))
+			return mvPythonTranslator::GetPyNone();
 
 		auto mcolor = mvPythonTranslator::ToColor(color);
 		if (mcolor.r > 999)
@@ -1999,7 +2299,9 @@ namespace Marvel {
 		if (mfill.r > 999)
 			mfill.specified = false;
 
-		mvSeries* series = new mvLineSeries(name, datapoints, weight, mcolor, mfill);
+		mvSeries* series = new mvLineSeries(name, {}, weight, mcolor, mfill);
+		series->setData(std::move(xs), std::move(ys));
+		series->setCapacity(capacity > 0 ? capacity : 0);
 
 		graph->addSeries(series);
 
@@ -2010,7 +2312,10 @@ namespace Marvel {
 	{
 		const char* plot;
 		const char* name;
-		PyObject* data;
+		PyObject* data = nullptr;
+		PyObject* x = nullptr;
+		PyObject* y = nullptr;
+		int capacity = 0;
 		int marker = 2;
 		float size = 4.0f;
 		float weight = 1.0f;
@@ -2026,15 +2331,8 @@ namespace Marvel {
 		PyTuple_SetItem(fill, 3, PyLong_FromLong(255));
 
 		if (!(*mvApp::GetApp()->getParsers())["add_scatter_series"].parse(args, kwargs, __FUNCTION__, &plot, &name, &data, &marker,
-			&size, &weight, &outline, &fill))
-			return mvPythonTranslator::GetPyNone();
-
-		if (!PyList_Check(data))
-		{
-			std::string message = plot;
-			ThrowPythonException(message + " add scatter series requires a list of lists.");
+			&size, &weight, &outline, &fill, &x, &y, &capacity))
 			return mvPythonTranslator::GetPyNone();
-		}
 
 		mvAppItem* aplot = mvApp::GetApp()->getItem(plot);
 
@@ -2054,7 +2352,10 @@ namespace Marvel {
 
 		mvPlot* graph = static_cast<mvPlot*>(aplot);
 
-		auto datapoints = mvPythonTranslator::ToVectVec2(data);
+		std::vector<float> xs;
+		std::vector<float> ys;
+		if (!GetSeriesData(plot, "add scatter series", data, x, y, xs, ys))
+			return mvPythonTranslator::GetPyNone();
 
 		auto mmarkerOutlineColor = mvPythonTranslator::ToColor(outline);
 		if (mmarkerOutlineColor.r > 999)
@@ -2064,14 +2365,62 @@ namespace Marvel {
 		if (mmarkerFillColor.r > 999)
 			mmarkerFillColor.specified = false;
 
-		mvSeries* series = new mvScatterSeries(name, datapoints, marker, size, weight, mmarkerOutlineColor,
+		mvSeries* series = new mvScatterSeries(name, {}, marker, size, weight, mmarkerOutlineColor,
 			mmarkerFillColor);
+		series->setData(std::move(xs), std::move(ys));
+		series->setCapacity(capacity > 0 ? capacity : 0);
 
 		graph->addSeries(series);
 
 		return mvPythonTranslator::GetPyNone();
 	}
 
+	PyObject* append_series_data(PyObject* self, PyObject* args, PyObject* kwargs)
+	{
+		const char* plot;
+		const char* series;
+		PyObject* data = nullptr;
+		PyObject* x = nullptr;
+		PyObject* y = nullptr;
+
+		if (!(*mvApp::GetApp()->getParsers())["append_series_data"].parse(args, kwargs, __FUNCTION__, &plot, &series, &data, &x, &y))
+			return mvPythonTranslator::GetPyNone();
+
+		mvAppItem* aplot = mvApp::GetApp()->getItem(plot);
+
+		if (aplot == nullptr)
+		{
+			std::string message = plot;
+			ThrowPythonException(message + " plot does not exist.");
+			return mvPythonTranslator::GetPyNone();
+		}
+
+		if (aplot->getType() != mvAppItemType::Plot)
+		{
+			std::string message = plot;
+			ThrowPythonException(message + " is not a plot.");
+			return mvPythonTranslator::GetPyNone();
+		}
+
+		mvSeries* aseries = static_cast<mvPlot*>(aplot)->getSeries(series);
+
+		if (aseries == nullptr)
+		{
+			std::string message = series;
+			ThrowPythonException(message + " series does not exist.");
+			return mvPythonTranslator::GetPyNone();
+		}
+
+		std::vector<float> xs;
+		std::vector<float> ys;
+		if (!GetSeriesData(plot, "append series data", data, x, y, xs, ys))
+			return mvPythonTranslator::GetPyNone();
+
+		aseries->appendData(xs, ys);
+
+		return mvPythonTranslator::GetPyNone();
+	}
+
 	PyObject* add_text_point(PyObject* self, PyObject* args, PyObject* kwargs)
 	{
 		const char* plot;
@@ -2531,6 +2880,30 @@ namespace Marvel {
 		return mvPythonTranslator::GetPyNone();
 	}
 
+	PyObject* set_input_callback(PyObject* self, PyObject* args, PyObject* kwargs)
+	{
+		const char* callback;
+		const char* handler = "MainWindow";
+
+		if (!(*mvApp::GetApp()->getParsers())["set_input_callback"].parse(args, kwargs, __FUNCTION__, &callback, &handler))
+			return mvPythonTranslator::GetPyNone();
+
+		if (std::string(handler) == "MainWindow")
+			mvApp::GetApp()->setInputCallback(std::string(callback));
+		else
+		{
+			mvAppItem* item;
+			item = mvApp::GetApp()->getItem(handler);
+			if (item)
+			{
+				auto windowtype = static_cast<mvWindowAppitem*>(item);
+				static_cast<mvEventHandler*>(windowtype)->setInputCallback(callback);
+			}
+		}
+
+		return mvPythonTranslator::GetPyNone();
+	}
+
 	PyObject* set_mouse_wheel_callback(PyObject* self, PyObject* args, PyObject* kwargs)
 	{
 		const char* callback;
@@ -3700,6 +4073,9 @@ namespace Marvel {
 
 	PyObject* add_tab_bar(PyObject* self, PyObject* args, PyObject* kwargs)
 	{
+		if (!CheckParentStackAccess(__FUNCTION__))
+			return mvPythonTranslator::GetPyNone();
+
 		const char* name;
 		int reorderable = false;
 		const char* callback = "";
@@ -3721,6 +4097,9 @@ namespace Marvel {
 
 	PyObject* add_tab(PyObject* self, PyObject* args, PyObject* kwargs)
 	{
+		if (!CheckParentStackAccess(__FUNCTION__))
+			return mvPythonTranslator::GetPyNone();
+
 		const char* name;
 		int closeable = false;
 		const char* tip = "";
@@ -3777,6 +4156,9 @@ namespace Marvel {
 
 	PyObject* end_tab(PyObject* self, PyObject* args, PyObject* kwargs)
 	{
+		if (!CheckParentStackAccess(__FUNCTION__))
+			return mvPythonTranslator::GetPyNone();
+
 		mvApp::GetApp()->popParent();
 		return mvPythonTranslator::GetPyNone();
 
@@ -3796,6 +4178,9 @@ namespace Marvel {
 
 	PyObject* end_tab_bar(PyObject* self, PyObject* args, PyObject* kwargs)
 	{
+		if (!CheckParentStackAccess(__FUNCTION__))
+			return mvPythonTranslator::GetPyNone();
+
 		mvApp::GetApp()->popParent();
 		return mvPythonTranslator::GetPyNone();
 
@@ -3828,6 +4213,9 @@ namespace Marvel {
 
 	PyObject* add_menu_bar(PyObject* self, PyObject* args, PyObject* kwargs)
 	{
+		if (!CheckParentStackAccess(__FUNCTION__))
+			return mvPythonTranslator::GetPyNone();
+
 		const char* name;
 		const char* before = "";
 		const char* parent = "";
@@ -3852,6 +4240,9 @@ namespace Marvel {
 
 	PyObject* add_menu(PyObject* self, PyObject* args, PyObject* kwargs)
 	{
+		if (!CheckParentStackAccess(__FUNCTION__))
+			return mvPythonTranslator::GetPyNone();
+
 		const char* name;
 		const char* tip = "";
 		const char* before = "";
@@ -3875,6 +4266,9 @@ namespace Marvel {
 
 	PyObject* end_menu(PyObject* self, PyObject* args, PyObject* kwargs)
 	{
+		if (!CheckParentStackAccess(__FUNCTION__))
+			return mvPythonTranslator::GetPyNone();
+
 		auto parentItem = mvApp::GetApp()->topParent();
 
 		if (parentItem == nullptr)
@@ -3891,6 +4285,9 @@ namespace Marvel {
 
 	PyObject* end_menu_bar(PyObject* self, PyObject* args, PyObject* kwargs)
 	{
+		if (!CheckParentStackAccess(__FUNCTION__))
+			return mvPythonTranslator::GetPyNone();
+
 		auto parentItem = mvApp::GetApp()->topParent();
 
 		if (parentItem == nullptr)
@@ -3999,6 +4396,9 @@ namespace Marvel {
 
 	PyObject* add_group(PyObject* self, PyObject* args, PyObject* kwargs)
 	{
+		if (!CheckParentStackAccess(__FUNCTION__))
+			return mvPythonTranslator::GetPyNone();
+
 		const char* name;
 		const char* tip = "";
 		int width = 0;
@@ -4024,6 +4424,9 @@ namespace Marvel {
 
 	PyObject* end_group(PyObject* self, PyObject* args, PyObject* kwargs)
 	{
+		if (!CheckParentStackAccess(__FUNCTION__))
+			return mvPythonTranslator::GetPyNone();
+
 		auto parentItem = mvApp::GetApp()->topParent();
 
 		if (parentItem == nullptr)
@@ -4040,6 +4443,9 @@ namespace Marvel {
 
 	PyObject* add_child(PyObject* self, PyObject* args, PyObject* kwargs)
 	{
+		if (!CheckParentStackAccess(__FUNCTION__))
+			return mvPythonTranslator::GetPyNone();
+
 		const char* name;
 		const char* tip = "";
 		int width = 0;
@@ -4064,6 +4470,9 @@ namespace Marvel {
 
 	PyObject* add_window(PyObject* self, PyObject* args, PyObject* kwargs)
 	{
+		if (!CheckParentStackAccess(__FUNCTION__))
+			return mvPythonTranslator::GetPyNone();
+
 		const char* name;
 		int width = -1;
 		int height = -1;
@@ -4100,6 +4509,9 @@ namespace Marvel {
 
 	PyObject* end_window(PyObject* self, PyObject* args, PyObject* kwargs)
 	{
+		if (!CheckParentStackAccess(__FUNCTION__))
+			return mvPythonTranslator::GetPyNone();
+
 
 		auto parentItem = mvApp::GetApp()->topParent();
 
@@ -4159,6 +4571,9 @@ namespace Marvel {
 
 	PyObject* end_child(PyObject* self, PyObject* args, PyObject* kwargs)
 	{
+		if (!CheckParentStackAccess(__FUNCTION__))
+			return mvPythonTranslator::GetPyNone();
+
 
 		auto parentItem = mvApp::GetApp()->topParent();
 
@@ -4176,6 +4591,9 @@ namespace Marvel {
 
 	PyObject* add_tooltip(PyObject* self, PyObject* args, PyObject* kwargs)
 	{
+		if (!CheckParentStackAccess(__FUNCTION__))
+			return mvPythonTranslator::GetPyNone();
+
 		const char* tipparent;
 		const char* name;
 		const char* parent = "";
@@ -4193,6 +4611,9 @@ namespace Marvel {
 
 	PyObject* end_tooltip(PyObject* self, PyObject* args, PyObject* kwargs)
 	{
+		if (!CheckParentStackAccess(__FUNCTION__))
+			return mvPythonTranslator::GetPyNone();
+
 
 		auto parentItem = mvApp::GetApp()->topParent();
 
@@ -4210,6 +4631,9 @@ namespace Marvel {
 
 	PyObject* add_popup(PyObject* self, PyObject* args, PyObject* kwargs)
 	{
+		if (!CheckParentStackAccess(__FUNCTION__))
+			return mvPythonTranslator::GetPyNone();
+
 		const char* popupparent;
 		const char* name;
 		int mousebutton = 1;
@@ -4240,6 +4664,9 @@ namespace Marvel {
 
 	PyObject* end_popup(PyObject* self, PyObject* args, PyObject* kwargs)
 	{
+		if (!CheckParentStackAccess(__FUNCTION__))
+			return mvPythonTranslator::GetPyNone();
+
 		auto parentItem = mvApp::GetApp()->topParent();
 
 		if (parentItem == nullptr)
@@ -4256,6 +4683,9 @@ namespace Marvel {
 
 	PyObject* add_collapsing_header(PyObject* self, PyObject* args, PyObject* kwargs)
 	{
+		if (!CheckParentStackAccess(__FUNCTION__))
+			return mvPythonTranslator::GetPyNone();
+
 		const char* name;
 		int default_open = false;
 		int closable = false;
@@ -4279,6 +4709,9 @@ namespace Marvel {
 
 	PyObject* end_collapsing_header(PyObject* self, PyObject* args, PyObject* kwargs)
 	{
+		if (!CheckParentStackAccess(__FUNCTION__))
+			return mvPythonTranslator::GetPyNone();
+
 		auto parentItem = mvApp::GetApp()->topParent();
 
 		if (parentItem == nullptr)
@@ -4295,6 +4728,9 @@ namespace Marvel {
 
 	PyObject* add_tree_node(PyObject* self, PyObject* args, PyObject* kwargs)
 	{
+		if (!CheckParentStackAccess(__FUNCTION__))
+			return mvPythonTranslator::GetPyNone();
+
 		const char* name;
 		int default_open = false;
 		int flags = 0;
@@ -4317,6 +4753,9 @@ namespace Marvel {
 
 	PyObject* end_tree_node(PyObject* self, PyObject* args, PyObject* kwargs)
 	{
+		if (!CheckParentStackAccess(__FUNCTION__))
+			return mvPythonTranslator::GetPyNone();
+
 		auto parentItem = mvApp::GetApp()->topParent();
 
 		if (parentItem == nullptr)
@@ -4528,6 +4967,107 @@ namespace Marvel {
 		return mvPythonTranslator::GetPyNone();
 	}
 
+	PyObject* set_table_data(PyObject* self, PyObject* args, PyObject* kwargs)
+	{
+		const char* table;
+		PyObject* columns;
+		PyObject* headers = nullptr;
+		PyObject* formats = nullptr;
+
+		if (!(*mvApp::GetApp()->getParsers())["set_table_data"].parse(args, kwargs, __FUNCTION__, &table, &columns,
+			&headers, &formats))
+			return mvPythonTranslator::GetPyNone();
+
+		mvAppItem* item = mvApp::GetApp()->getItem(table);
+		if (item == nullptr)
+		{
+			std::string message = table;
+			ThrowPythonException(message + " table does not exist.");
+			return mvPythonTranslator::GetPyNone();
+		}
+
+		if (item->getType() != mvAppItemType::Table)
+		{
+			std::string message = table;
+			ThrowPythonException(message + " is not a table.");
+			return mvPythonTranslator::GetPyNone();
+		}
+
+		if (!PyList_Check(columns) && !PyTuple_Check(columns))
+		{
+			ThrowPythonException("set_table_data requires a list/tuple of columns.");
+			return mvPythonTranslator::GetPyNone();
+		}
+
+		std::vector<std::string> pformats;
+		if (formats)
+			pformats = mvPythonTranslator::ToStringVect(formats);
+
+		// converted natively, numeric buffers are formatted without touching python objects
+		std::vector<std::vector<std::string>> pcolumns;
+		Py_ssize_t count = PySequence_Size(columns);
+		for (Py_ssize_t i = 0; i < count; i++)
+		{
+			// the table is left unchanged if any column is invalid
+			bool valid = false;
+			PyObject* column = PySequence_GetItem(columns, i);
+			if (column)
+				pcolumns.push_back(mvPythonTranslator::ToStringVect(column, "set_table_data columns must be lists/tuples or buffers.",
+					i < (Py_ssize_t)pformats.size() ? pformats[i] : "", &valid));
+			else
+				PyErr_Clear();
+			Py_XDECREF(column);
+			if (!valid)
+				return mvPythonTranslator::GetPyNone();
+		}
+
+		mvTable* atable = static_cast<mvTable*>(item);
+		atable->setColumns(std::move(pcolumns));
+
+		if (headers)
+			atable->addHeaders(mvPythonTranslator::ToStringVect(headers));
+
+		return mvPythonTranslator::GetPyNone();
+	}
+
+	PyObject* set_table_rows(PyObject* self, PyObject* args, PyObject* kwargs)
+	{
+		const char* table;
+		int start;
+		PyObject* rows;
+
+		if (!(*mvApp::GetApp()->getParsers())["set_table_rows"].parse(args, kwargs, __FUNCTION__, &table, &start, &rows))
+			return mvPythonTranslator::GetPyNone();
+
+		mvAppItem* item = mvApp::GetApp()->getItem(table);
+		if (item == nullptr)
+		{
+			std::string message = table;
+			ThrowPythonException(message + " table does not exist.");
+			return mvPythonTranslator::GetPyNone();
+		}
+
+		if (item->getType() != mvAppItemType::Table)
+		{
+			std::string message = table;
+			ThrowPythonException(message + " is not a table.");
+			return mvPythonTranslator::GetPyNone();
+		}
+
+		auto prows = mvPythonTranslator::ToVectVectString(rows, "set_table_rows requires a list/tuple of rows.");
+		mvTable* atable = static_cast<mvTable*>(item);
+		if (atable->getColumnCount() == 0 && !prows.empty())
+		{
+			std::vector<std::string> headers;
+			for (size_t i = 0; i < prows[0].size(); i++)
+				headers.emplace_back("Header" + std::to_string(i));
+			atable->addHeaders(headers);
+		}
+		atable->setRows(start, std::move(prows));
+
+		return mvPythonTranslator::GetPyNone();
+	}
+
 	PyObject* delete_row(PyObject* self, PyObject* args, PyObject* kwargs)
 	{
 		const char* table;
@@ -4882,15 +5422,24 @@ namespace Marvel {
 
 	PyObject* delete_item(PyObject* self, PyObject* args, PyObject* kwargs)
 	{
-		if (!mvApp::GetApp()->checkIfMainThread())
-			return mvPythonTranslator::GetPyNone();
-
 		const char* item;
 		int childrenOnly = false;
 
 		if (!(*mvApp::GetApp()->getParsers())["delete_item"].parse(args, kwargs, __FUNCTION__, &item, &childrenOnly))
 			return mvPythonTranslator::GetPyNone();
 
+		if (!mvApp::GetApp()->isMainThread())
+		{
+			std::string name = item;
+			mvApp::GetApp()->submitCommand([name, childrenOnly]() {
+				if (childrenOnly)
+					mvApp::GetApp()->deleteItemChildren(name);
+				else
+					mvApp::GetApp()->deleteItem(name);
+			});
+			return mvPythonTranslator::GetPyNone();
+		}
+
 		if (childrenOnly)
 			mvApp::GetApp()->deleteItemChildren(item);
 		else
@@ -5131,6 +5680,15 @@ namespace Marvel {
 		if (!(*mvApp::GetApp()->getParsers())["add_data"].parse(args, kwargs, __FUNCTION__, &name, &data))
 			return mvPythonTranslator::GetPyNone();
 
+		// the reference is handed to the storage when the command runs
+		if (!mvApp::GetApp()->isMainThread())
+		{
+			std::string dataName = name;
+			Py_XINCREF(data);
+			mvApp::GetApp()->submitCommand([dataName, data]() { mvDataStorage::AddData(dataName, data); });
+			return mvPythonTranslator::GetPyNone();
+		}
+
 		mvDataStorage::AddData(name, data);
 		Py_XINCREF(data);
 
@@ -5172,6 +5730,130 @@ namespace Marvel {
 		return mvPythonTranslator::GetPyNone();
 	}
 
+	PyObject* set_power_saving_mode(PyObject* self, PyObject* args, PyObject* kwargs)
+	{
+		int value;
+
+		if (!(*mvApp::GetApp()->getParsers())["set_power_saving_mode"].parse(args, kwargs, __FUNCTION__, &value))
+			return mvPythonTranslator::GetPyNone();
+
+		mvApp::GetApp()->setPowerSaving(value);
+		mvApp::GetApp()->requestRedraw();
+
+		return mvPythonTranslator::GetPyNone();
+	}
+
+	PyObject* is_power_saving_mode(PyObject* self, PyObject* args, PyObject* kwargs)
+	{
+		return mvPythonTranslator::ToPyBool(mvApp::GetApp()->getPowerSaving());
+	}
+
+	PyObject* request_redraw(PyObject* self, PyObject* args, PyObject* kwargs)
+	{
+		mvApp::GetApp()->requestRedraw();
+		return mvPythonTranslator::GetPyNone();
+	}
+
+	PyObject* set_profiling(PyObject* self, PyObject* args, PyObject* kwargs)
+	{
+		int value;
+
+		if (!(*mvApp::GetApp()->getParsers())["set_profiling"].parse(args, kwargs, __FUNCTION__, &value))
+			return mvPythonTranslator::GetPyNone();
+
+		mvProfiler::setEnabled(value);
+
+		return mvPythonTranslator::GetPyNone();
+	}
+
+	PyObject* is_profiling(PyObject* self, PyObject* args, PyObject* kwargs)
+	{
+		return mvPythonTranslator::ToPyBool(mvProfiler::isEnabled());
+	}
+
+	PyObject* get_profile_zones(PyObject* self, PyObject* args, PyObject* kwargs)
+	{
+		// frames are written by the main thread
+		if (!mvApp::GetApp()->checkIfMainThread())
+			return mvPythonTranslator::GetPyNone();
+
+		auto frames = mvProfiler::getFrames();
+		if (frames.empty())
+			return PyList_New(0);
+
+		const mvProfiler::Frame& frame = *frames.back();
+		PyObject* result = PyList_New(frame.zones.size());
+		for (size_t i = 0; i < frame.zones.size(); i++)
+		{
+			const mvProfiler::Zone& zone = frame.zones[i];
+			PyObject* item = PyList_New(4);
+			PyList_SetItem(item, 0, PyUnicode_FromStringAndSize(frame.names.data() + zone.nameOffset, zone.nameLength));
+			PyList_SetItem(item, 1, PyFloat_FromDouble((double)(zone.start - frame.start) / 1000000.0));
+			PyList_SetItem(item, 2, PyFloat_FromDouble((double)(zone.end - zone.start) / 1000000.0));
+			PyList_SetItem(item, 3, PyLong_FromLong(zone.depth));
+			PyList_SetItem(result, i, item);
+		}
+
+		return result;
+	}
+
+	PyObject* export_profile_trace(PyObject* self, PyObject* args, PyObject* kwargs)
+	{
+		const char* file;
+
+		if (!(*mvApp::GetApp()->getParsers())["export_profile_trace"].parse(args, kwargs, __FUNCTION__, &file))
+			return mvPythonTranslator::GetPyNone();
+
+		if (!mvApp::GetApp()->checkIfMainThread())
+			return mvPythonTranslator::GetPyNone();
+
+		if (!mvProfiler::exportChromeTrace(file))
+			ThrowPythonException(std::string(file) + " could not be written");
+
+		return mvPythonTranslator::GetPyNone();
+	}
+
+	PyObject* set_texture_upload_budget(PyObject* self, PyObject* args, PyObject* kwargs)
+	{
+		int bytes;
+
+		if (!(*mvApp::GetApp()->getParsers())["set_texture_upload_budget"].parse(args, kwargs, __FUNCTION__, &bytes))
+			return mvPythonTranslator::GetPyNone();
+
+		if (bytes < 0)
+		{
+			ThrowPythonException("bytes must not be negative");
+			return mvPythonTranslator::GetPyNone();
+		}
+
+		mvTextureStorage::SetUploadBudget((size_t)bytes);
+
+		return mvPythonTranslator::GetPyNone();
+	}
+
+	PyObject* get_texture_upload_budget(PyObject* self, PyObject* args, PyObject* kwargs)
+	{
+		return mvPythonTranslator::ToPyInt((int)std::min<size_t>(mvTextureStorage::GetUploadBudget(), std::numeric_limits<int>::max()));
+	}
+
+	PyObject* set_texture_memory_budget(PyObject* self, PyObject* args, PyObject* kwargs)
+	{
+		int bytes;
+
+		if (!(*mvApp::GetApp()->getParsers())["set_texture_memory_budget"].parse(args, kwargs, __FUNCTION__, &bytes))
+			return mvPythonTranslator::GetPyNone();
+
+		if (bytes < 0)
+		{
+			ThrowPythonException("bytes must not be negative");
+			return mvPythonTranslator::GetPyNone();
+		}
+
+		mvTextureStorage::SetMemoryBudget((size_t)bytes);
+
+		return mvPythonTranslator::GetPyNone();
+	}
+
 	PyObject* add_item_color_style(PyObject* self, PyObject* args, PyObject* kwargs)
 	{
 		const char* item;
@@ -5436,15 +6118,18 @@ namespace Marvel {
 		if (!(*mvApp::GetApp()->getParsers())["set_value"].parse(args, kwargs, __FUNCTION__, &name, &value))
 			return mvPythonTranslator::GetPyNone();
 
-		mvAppItem* item = mvApp::GetApp()->getItem(std::string(name));
-
-		if (item == nullptr)
+		if (!mvApp::GetApp()->isMainThread())
+		{
+			std::string itemName = name;
+			Py_XINCREF(value);
+			mvApp::GetApp()->submitCommand([itemName, value]() {
+				SetItemValue(itemName, value);
+				Py_XDECREF(value);
+			});
 			return mvPythonTranslator::GetPyNone();
+		}
 
-		if (item->getDataSource().empty())
-			item->setPyValue(value);
-		else
-			mvDataStorage::AddData(item->getDataSource(), value);
+		SetItemValue(name, value);
 
 		return mvPythonTranslator::GetPyNone();
 	}
@@ -6341,7 +7026,11 @@ namespace Marvel {
 		ADD_PYTHON_FUNCTION(draw_polyline)
 		ADD_PYTHON_FUNCTION(draw_polygon)
 		ADD_PYTHON_FUNCTION(draw_bezier_curve)
+		ADD_PYTHON_FUNCTION(draw_circles)
+		ADD_PYTHON_FUNCTION(draw_lines)
+		ADD_PYTHON_FUNCTION(draw_rectangles)
 		ADD_PYTHON_FUNCTION(clear_drawing)
+		ADD_PYTHON_FUNCTION(delete_draw_command)
 		ADD_PYTHON_FUNCTION(add_column)
 		ADD_PYTHON_FUNCTION(insert_column)
 		ADD_PYTHON_FUNCTION(delete_column)
@@ -6350,6 +7039,8 @@ namespace Marvel {
 		ADD_PYTHON_FUNCTION(delete_row)
 		ADD_PYTHON_FUNCTION(get_table_item)
 		ADD_PYTHON_FUNCTION(set_table_item)
+		ADD_PYTHON_FUNCTION(set_table_data)
+		ADD_PYTHON_FUNCTION(set_table_rows)
 		ADD_PYTHON_FUNCTION(set_table_selection)
 		ADD_PYTHON_FUNCTION(get_table_selections)
 		ADD_PYTHON_FUNCTION(get_delta_time)
@@ -6385,6 +7076,16 @@ namespace Marvel {
 		ADD_PYTHON_FUNCTION(set_thread_count)
 		ADD_PYTHON_FUNCTION(set_threadpool_high_performance)
 		ADD_PYTHON_FUNCTION(set_main_window_size)
+		ADD_PYTHON_FUNCTION(set_power_saving_mode)
+		ADD_PYTHON_FUNCTION(is_power_saving_mode)
+		ADD_PYTHON_FUNCTION(request_redraw)
+		ADD_PYTHON_FUNCTION(set_profiling)
+		ADD_PYTHON_FUNCTION(is_profiling)
+		ADD_PYTHON_FUNCTION(get_profile_zones)
+		ADD_PYTHON_FUNCTION(export_profile_trace)
+		ADD_PYTHON_FUNCTION(set_texture_upload_budget)
+		ADD_PYTHON_FUNCTION(get_texture_upload_budget)
+		ADD_PYTHON_FUNCTION(set_texture_memory_budget)
 		ADD_PYTHON_FUNCTION(add_item_color_style)
 		ADD_PYTHON_FUNCTION(set_item_popup)
 		ADD_PYTHON_FUNCTION(is_item_hovered)
@@ -6429,6 +7130,7 @@ namespace Marvel {
 		ADD_PYTHON_FUNCTION(set_key_down_callback)
 		ADD_PYTHON_FUNCTION(set_key_press_callback)
 		ADD_PYTHON_FUNCTION(set_key_release_callback)
+		ADD_PYTHON_FUNCTION(set_input_callback)
 		ADD_PYTHON_FUNCTION(set_resize_callback)
 		ADD_PYTHON_FUNCTION(get_log_level)
 		ADD_PYTHON_FUNCTION(clear_log)
@@ -6442,6 +7144,7 @@ namespace Marvel {
 		ADD_PYTHON_FUNCTION(is_plot_queried)
 		ADD_PYTHON_FUNCTION(get_plot_query_area)
 		ADD_PYTHON_FUNCTION(clear_plot)
+		ADD_PYTHON_FUNCTION(append_series_data)
 		ADD_PYTHON_FUNCTION(reset_xticks)
 		ADD_PYTHON_FUNCTION(reset_yticks)
 		ADD_PYTHON_FUNCTION(set_xticks)
@@ -0,0 +1,256 @@
+#include "mvProfiler.h"
+#include <imgui.h>
+#include <chrono>
+#include <fstream>
+#include <algorithm>
+#include <cstdio>
+#include <cfloat>
+
+namespace Marvel {
+
+	std::atomic_bool        mvProfiler::s_enabled{ false };
+	std::atomic_bool        mvProfiler::s_paused{ false };
+	thread_local bool       mvProfiler::s_recording = false;
+	mvProfiler::Frame       mvProfiler::s_frames[mvProfiler::s_frameCount];
+	std::uint64_t           mvProfiler::s_frameIndex = 0;
+	std::vector<int>        mvProfiler::s_openZones;
+	int                     mvProfiler::s_selectedFrame = 0;
+
+	static const auto s_epoch = std::chrono::steady_clock::now();
+
+	static std::int64_t Now()
+	{
+		return std::chrono::duration_cast<std::chrono::nanoseconds>(std::chrono::steady_clock::now() - s_epoch).count();
+	}
+
+	void mvProfiler::BeginFrame()
+	{
+		s_recording = s_enabled && !s_paused;
+		if (!s_recording)
+			return;
+
+		// buffers are reused so recording doesn't allocate once warmed up
+		Frame& frame = s_frames[s_frameIndex % s_frameCount];
+		frame.index = s_frameIndex;
+		frame.start = Now();
+		frame.end = frame.start;
+		frame.zones.clear();
+		frame.names.clear();
+		s_openZones.clear();
+	}
+
+	void mvProfiler::EndFrame()
+	{
+		if (!s_recording)
+			return;
+
+		Frame& frame = s_frames[s_frameIndex % s_frameCount];
+		frame.end = Now();
+
+		// zones left open (i.e. by an exception) end with the frame
+		for (int zone : s_openZones)
+			frame.zones[zone].end = frame.end;
+		s_openZones.clear();
+
+		s_frameIndex++;
+		s_recording = false;
+	}
+
+	void mvProfiler::BeginZone(const char* name, size_t length)
+	{
+		if (!s_recording)
+			return;
+
+		Frame& frame = s_frames[s_frameIndex % s_frameCount];
+
+		Zone zone;
+		zone.start = Now();
+		zone.end = zone.start;
+		zone.nameOffset = (unsigned)frame.names.size();
+		zone.nameLength = (unsigned)length;
+		zone.depth = (int)s_openZones.size();
+
+		frame.names.append(name, length);
+		s_openZones.push_back((int)frame.zones.size());
+		frame.zones.push_back(zone);
+	}
+
+	void mvProfiler::EndZone()
+	{
+		// the frame may have ended (and closed the zone) already
+		if (!s_recording || s_openZones.empty())
+			return;
+
+		Frame& frame = s_frames[s_frameIndex % s_frameCount];
+		frame.zones[s_openZones.back()].end = Now();
+		s_openZones.pop_back();
+	}
+
+	std::vector<const mvProfiler::Frame*> mvProfiler::getFrames()
+	{
+		// the slot after the newest frame is the one being recorded
+		std::uint64_t count = std::min<std::uint64_t>(s_frameIndex, s_frameCount - 1);
+
+		std::vector<const Frame*> frames;
+		frames.reserve((size_t)count);
+		for (std::uint64_t i = s_frameIndex - count; i < s_frameIndex; i++)
+			frames.push_back(&s_frames[i % s_frameCount]);
+		return frames;
+	}
+
+	static void WriteJsonString(std::ofstream& stream, const char* text, size_t length)
+	{
+		stream << '"';
+		for (size_t i = 0; i < length; i++)
+		{
+			char c = text[i];
+			if (c == '"' || c == '\\')
+				stream << '\\' << c;
+			else if ((unsigned char)c < 0x20)
+			{
+				char escaped[8];
+				snprintf(escaped, sizeof(escaped), "\\u%04x", (unsigned)c);
+				stream << escaped;
+			}
+			else
+				stream << c;
+		}
+		stream << '"';
+	}
+
+	static void WriteTraceEvent(std::ofstream& stream, const char* name, size_t length, std::int64_t start, std::int64_t end, bool& first)
+	{
+		if (!first)
+			stream << ",\n";
+		first = false;
+
+		// complete events, timestamps in microseconds
+		char timing[96];
+		snprintf(timing, sizeof(timing), "\"ph\":\"X\",\"pid\":1,\"tid\":1,\"ts\":%.3f,\"dur\":%.3f",
+			(double)start / 1000.0, (double)(end - start) / 1000.0);
+
+		stream << "{\"name\":";
+		WriteJsonString(stream, name, length);
+		stream << ',' << timing << '}';
+	}
+
+	bool mvProfiler::exportChromeTrace(const std::string& file)
+	{
+		std::ofstream stream(file, std::ios::out | std::ios::trunc);
+		if (!stream.is_open())
+			return false;
+
+		stream << "{\"displayTimeUnit\":\"ms\",\"traceEvents\":[\n";
+
+		bool first = true;
+		for (const Frame* frame : getFrames())
+		{
+			std::string name = "Frame " + std::to_string(frame->index);
+			WriteTraceEvent(stream, name.c_str(), name.size(), frame->start, frame->end, first);
+
+			for (const Zone& zone : frame->zones)
+				WriteTraceEvent(stream, frame->names.data() + zone.nameOffset, zone.nameLength, zone.start, zone.end, first);
+		}
+
+		stream << "\n]}\n";
+		return stream.good();
+	}
+
+	static ImU32 ZoneColor(const char* name, size_t length)
+	{
+		// stable color per zone name (FNV-1a)
+		unsigned hash = 2166136261u;
+		for (size_t i = 0; i < length; i++)
+			hash = (hash ^ (unsigned char)name[i]) * 16777619u;
+		float hue = (float)(hash % 360) / 360.0f;
+		float r, g, b;
+		ImGui::ColorConvertHSVtoRGB(hue, 0.5f, 0.7f, r, g, b);
+		return ImGui::GetColorU32(ImVec4(r, g, b, 1.0f));
+	}
+
+	void mvProfiler::render()
+	{
+		bool enabled = s_enabled;
+		if (ImGui::Checkbox("Record", &enabled))
+			s_enabled = enabled;
+
+		ImGui::SameLine();
+		bool paused = s_paused;
+		if (ImGui::Checkbox("Pause", &paused))
+			s_paused = paused;
+
+		ImGui::SameLine();
+		if (ImGui::Button("Export Chrome Trace"))
+			exportChromeTrace("dearpygui_trace.json");
+
+		auto frames = getFrames();
+		if (frames.empty())
+		{
+			ImGui::Text("No frames recorded.");
+			return;
+		}
+
+		// frame times, newest on the right
+		std::vector<float> times;
+		times.reserve(frames.size());
+		for (const Frame* frame : frames)
+			times.push_back((float)(frame->end - frame->start) / 1000000.0f);
+		ImGui::PlotHistogram("##frametimes", times.data(), (int)times.size(), 0, "frame times (ms)",
+			0.0f, FLT_MAX, ImVec2(-1.0f, 60.0f));
+
+		// selection is kept relative to the newest frame so it follows live recording
+		int count = (int)frames.size();
+		s_selectedFrame = std::clamp(s_selectedFrame, 0, count - 1);
+		int selected = count - 1 - s_selectedFrame;
+		if (ImGui::SliderInt("Frame", &selected, 0, count - 1))
+			s_selectedFrame = count - 1 - selected;
+
+		const Frame& frame = *frames[selected];
+		double duration = (double)std::max<std::int64_t>(frame.end - frame.start, 1);
+		ImGui::Text("Frame %llu: %.3f ms, %d zones", (unsigned long long)frame.index, duration / 1000000.0, (int)frame.zones.size());
+
+		int maxDepth = 0;
+		for (const Zone& zone : frame.zones)
+			maxDepth = std::max(maxDepth, zone.depth);
+
+		// timeline, one row per nesting depth
+		float rowHeight = ImGui::GetTextLineHeightWithSpacing();
+		ImVec2 origin = ImGui::GetCursorScreenPos();
+		float width = std::max(ImGui::GetContentRegionAvail().x, 1.0f);
+		ImGui::InvisibleButton("##timeline", ImVec2(width, rowHeight * (float)(maxDepth + 1)));
+		bool hovered = ImGui::IsItemHovered();
+		ImVec2 mouse = ImGui::GetMousePos();
+
+		ImDrawList* drawlist = ImGui::GetWindowDrawList();
+		double scale = (double)width / duration;
+		ImU32 textColor = ImGui::GetColorU32(ImGuiCol_Text);
+
+		for (const Zone& zone : frame.zones)
+		{
+			const char* name = frame.names.data() + zone.nameOffset;
+
+			ImVec2 pmin(origin.x + (float)((double)(zone.start - frame.start) * scale), origin.y + rowHeight * (float)zone.depth);
+			ImVec2 pmax(origin.x + (float)((double)(zone.end - frame.start) * scale), pmin.y + rowHeight - 1.0f);
+			pmax.x = std::max(pmax.x, pmin.x + 1.0f);
+
+			drawlist->AddRectFilled(pmin, pmax, ZoneColor(name, zone.nameLength));
+
+			// label only zones wide enough to read
+			if (pmax.x - pmin.x > 20.0f)
+			{
+				drawlist->PushClipRect(pmin, pmax, true);
+				drawlist->AddText(ImVec2(pmin.x + 2.0f, pmin.y), textColor, name, name + zone.nameLength);
+				drawlist->PopClipRect();
+			}
+
+			if (hovered && mouse.x >= pmin.x && mouse.x < pmax.x && mouse.y >= pmin.y && mouse.y < pmax.y)
+			{
+				ImGui::BeginTooltip();
+				ImGui::TextUnformatted(name, name + zone.nameLength);
+				ImGui::Text("%.3f ms", (double)(zone.end - zone.start) / 1000000.0);
+				ImGui::EndTooltip();
+			}
+		}
+	}
+
+}
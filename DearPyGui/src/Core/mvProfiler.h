@@ -0,0 +1,131 @@
+#pragma once
+
+//-----------------------------------------------------------------------------
+// mvProfiler
+//
+//     - Records named, nested timing zones for the main thread into a ring
+//       of recent frames. Zones are cheap to leave in place, when profiling
+//       is off a zone is a single flag check.
+//
+//     - Recorded frames are shown as a timeline in the metrics window and
+//       can be exported in the Chrome trace event format (chrome://tracing).
+//
+//-----------------------------------------------------------------------------
+
+#include <string>
+#include <vector>
+#include <cstdint>
+#include <atomic>
+
+namespace Marvel {
+
+	//-----------------------------------------------------------------------------
+	// mvProfiler
+	//-----------------------------------------------------------------------------
+	class mvProfiler
+	{
+
+	public:
+
+		struct Zone
+		{
+			std::int64_t start;      // ns since the profiler started
+			std::int64_t end;
+			unsigned     nameOffset; // into the frame's name buffer
+			unsigned     nameLength;
+			int          depth;
+		};
+
+		struct Frame
+		{
+			std::uint64_t     index = 0;
+			std::int64_t      start = 0;
+			std::int64_t      end   = 0;
+			std::vector<Zone> zones;
+			std::string       names;
+		};
+
+	public:
+
+		// called by the viewport around each frame
+		static void BeginFrame();
+		static void EndFrame  ();
+
+		// zones outside of a frame or off the main thread are ignored
+		static void BeginZone (const char* name, size_t length);
+		static void EndZone   ();
+
+		static void setEnabled(bool value) { s_enabled = value; }
+		static void setPaused (bool value) { s_paused = value; }
+		static bool isEnabled () { return s_enabled; }
+		static bool isPaused  () { return s_paused; }
+		static bool isRecording() { return s_recording; }
+
+		// recorded frames from oldest to newest
+		static std::vector<const Frame*> getFrames();
+
+		static bool exportChromeTrace(const std::string& file);
+
+		// profiler section of the metrics window
+		static void render();
+
+	private:
+
+		mvProfiler() = default;
+
+		static constexpr unsigned s_frameCount = 120;
+
+		static std::atomic_bool  s_enabled;
+		static std::atomic_bool  s_paused;
+		static thread_local bool s_recording;     // only set on the main thread inside a frame
+		static Frame             s_frames[s_frameCount];
+		static std::uint64_t     s_frameIndex;    // frames recorded so far
+		static std::vector<int>  s_openZones;
+		static int               s_selectedFrame; // offset from the newest frame
+
+	};
+
+	//-----------------------------------------------------------------------------
+	// mvProfileScope
+	//-----------------------------------------------------------------------------
+	class mvProfileScope
+	{
+
+	public:
+
+		explicit mvProfileScope(const char* name)
+			: m_active(mvProfiler::isRecording())
+		{
+			if (m_active)
+				mvProfiler::BeginZone(name, std::char_traits<char>::length(name));
+		}
+
+		explicit mvProfileScope(const std::string& name)
+			: m_active(mvProfiler::isRecording())
+		{
+			if (m_active)
+				mvProfiler::BeginZone(name.data(), name.size());
+		}
+
+		~mvProfileScope()
+		{
+			if (m_active)
+				mvProfiler::EndZone();
+		}
+
+		mvProfileScope(const mvProfileScope& other) = delete;
+		mvProfileScope& operator=(const mvProfileScope& other) = delete;
+
+	private:
+
+		bool m_active;
+
+	};
+
+}
+
+#define MV_PROFILE_CONCAT_IMPL(a, b) a##b
+#define MV_PROFILE_CONCAT(a, b) MV_PROFILE_CONCAT_IMPL(a, b)
+
+// times the rest of the enclosing scope under name
+#define MV_PROFILE_SCOPE(name) Marvel::mvProfileScope MV_PROFILE_CONCAT(mv_profile_scope_, __LINE__)(name)
@@ -14,6 +14,7 @@ namespace Marvel {
 		switch (type)
 		{
 		case mvPythonDataType::String:     return 's';
+		case mvPythonDataType::Callable:   return 's';
 		case mvPythonDataType::Integer:    return 'i';
 		case mvPythonDataType::Float:      return 'f';
 		case mvPythonDataType::Bool:       return 'p';
@@ -37,6 +38,7 @@ namespace Marvel {
 		case mvPythonDataType::Optional:   return "Optional Arguments\n____________________";
 		case mvPythonDataType::KeywordOnly:return "Keyword Only Arguments\n____________________";
 		case mvPythonDataType::Object:     return " : object";
+		case mvPythonDataType::Callable:   return " : Union[str, Callable]";
 		default:                           return " : unknown";
 		}
 	}
@@ -53,6 +55,7 @@ namespace Marvel {
 		case mvPythonDataType::FloatList:  return "List[float]";
 		case mvPythonDataType::IntList:    return "List[int]";
 		case mvPythonDataType::Object:     return "object";
+		case mvPythonDataType::Callable:   return "Union[str, Callable]";
 		default:                           return "";
 		}
 	}
@@ -75,7 +78,11 @@ namespace Marvel {
 		{
 			// ignore name types for optional and keyword only
 			if (element.type != mvPythonDataType::Optional && element.type != mvPythonDataType::KeywordOnly)
+			{
+				if (element.type == mvPythonDataType::Callable)
+					m_callbacks.push_back((int)m_keywords.size());
 				m_keywords.push_back(element.name);
+			}
 
 			// ignore additional optionals
 			if (m_optional && element.type == mvPythonDataType::Optional)
@@ -109,9 +116,60 @@ namespace Marvel {
 
 		bool check = true;
 
+		// callbacks may be given as callables, these are registered and
+		// replaced by their generated name. Names being (re)registered drop
+		// any cached resolution.
+		PyObject* callArgs = args;
+		PyObject* callKwargs = kwargs;
+		for (int index : m_callbacks)
+		{
+			bool positional = index < PyTuple_Size(callArgs);
+			PyObject* value = positional ? PyTuple_GetItem(callArgs, index) : nullptr;
+			if (!positional && callKwargs)
+				value = PyDict_GetItemString(callKwargs, m_keywords[index]);
+
+			if (value == nullptr)
+				continue;
+
+			if (PyUnicode_Check(value))
+			{
+				mvApp::GetApp()->invalidateCallback(_PyUnicode_AsString(value));
+				continue;
+			}
+
+			// anything else is left for the parse error
+			if (!PyCallable_Check(value))
+				continue;
+
+			// kept alive by the callback cache so the parsed string stays valid
+			PyObject* name = mvApp::GetApp()->registerCallable(value);
+
+			if (positional)
+			{
+				if (callArgs == args)
+				{
+					callArgs = PyTuple_New(PyTuple_Size(args));
+					for (Py_ssize_t i = 0; i < PyTuple_Size(args); i++)
+					{
+						Py_INCREF(PyTuple_GetItem(args, i));
+						PyTuple_SetItem(callArgs, i, PyTuple_GetItem(args, i));
+					}
+				}
+				Py_INCREF(name);
+				Py_DECREF(PyTuple_GetItem(callArgs, index));
+				PyTuple_SET_ITEM(callArgs, index, name);
+			}
+			else
+			{
+				if (callKwargs == kwargs)
+					callKwargs = PyDict_Copy(kwargs);
+				PyDict_SetItemString(callKwargs, m_keywords[index], name);
+			}
+		}
+
 		va_list arguments;
 		va_start(arguments, message);
-		if (!PyArg_VaParseTupleAndKeywords(args, kwargs, m_formatstring.data(),
+		if (!PyArg_VaParseTupleAndKeywords(callArgs, callKwargs, m_formatstring.data(),
 			const_cast<char**>(m_keywords.data()), arguments))
 		{
 			PyErr_Print();
@@ -126,6 +184,11 @@ namespace Marvel {
 
 		va_end(arguments);
 
+		if (callArgs != args)
+			Py_DECREF(callArgs);
+		if (callKwargs != kwargs)
+			Py_DECREF(callKwargs);
+
 		return check;
 	}
 
@@ -170,7 +233,7 @@ namespace Marvel {
 		std::ofstream stub;
 		stub.open(file + "/dearpygui.pyi");
 
-		stub << "from typing import List, Any\n\n";
+		stub << "from typing import List, Any, Callable, Union\n\n";
 
 		for (const auto& parser : *commands)
 		{
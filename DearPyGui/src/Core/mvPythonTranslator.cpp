@@ -2,6 +2,12 @@
 #include "mvApp.h"
 #include "mvAppLog.h"
 #include "Core/mvPythonExceptions.h"
+#include <cstring>
+#include <cstdint>
+#include <cmath>
+#include <type_traits>
+#include <cstdio>
+#include <algorithm>
 
 namespace Marvel {
 
@@ -129,6 +135,18 @@ namespace Marvel {
 		return result;
 	}
 
+	PyObject* mvPythonTranslator::ToPyList(const std::vector<std::pair<int, float>>& value)
+	{
+		mvGlobalIntepreterLock gil;
+
+		PyObject* result = PyList_New(value.size());
+
+		for (size_t i = 0; i < value.size(); i++)
+			PyList_SetItem(result, i, ToPyMPair(value[i].first, value[i].second));
+
+		return result;
+	}
+
 	int mvPythonTranslator::ToInt(PyObject* value, const std::string& message)
 	{
 		mvGlobalIntepreterLock gil;
@@ -227,12 +245,106 @@ namespace Marvel {
 		return items;
 	}
 
-	std::vector<float> mvPythonTranslator::ToFloatVect(PyObject* value, const std::string& message)
+	// Returns the struct format code of a buffer holding a single numeric
+	// type in native byte order, or 0. Standard size prefixes are accepted
+	// since the copies check the item size.
+	static char BufferFormatCode(const Py_buffer& view)
+	{
+		const std::uint16_t probe = 1;
+		const bool littleEndian = *(const std::uint8_t*)&probe == 1;
+
+		const char* format = view.format ? view.format : "B";
+		if (*format == '@' || *format == '=')
+			format++;
+		else if (*format == '<' || *format == '>' || *format == '!')
+		{
+			if ((*format == '<') != littleEndian)
+				return 0;
+			format++;
+		}
+
+		return format[0] != 0 && format[1] == 0 ? format[0] : 0;
+	}
+
+	template<typename T>
+	static bool CopyBufferToFloatVect(const Py_buffer& view, std::vector<float>& items)
+	{
+		if (view.itemsize != (Py_ssize_t)sizeof(T))
+			return false;
+
+		auto data = static_cast<const T*>(view.buf);
+		items.resize(view.len / view.itemsize);
+		for (size_t i = 0; i < items.size(); i++)
+			items[i] = (float)data[i];
+		return true;
+	}
+
+	bool mvPythonTranslator::BufferToFloatVect(PyObject* value, std::vector<float>& items)
+	{
+		mvGlobalIntepreterLock gil;
+
+		Py_buffer view;
+		if (PyObject_GetBuffer(value, &view, PyBUF_CONTIG_RO | PyBUF_FORMAT) != 0)
+		{
+			PyErr_Clear();
+			return false;
+		}
+
+		bool result = false;
+		switch (BufferFormatCode(view))
+		{
+		case 'f':
+			result = view.itemsize == (Py_ssize_t)sizeof(float);
+			if (result)
+			{
+				items.resize(view.len / view.itemsize);
+				if (!items.empty())
+					memcpy(items.data(), view.buf, items.size() * sizeof(float));
+			}
+			break;
+		case 'd': result = CopyBufferToFloatVect<double>            (view, items); break;
+		case 'b': result = CopyBufferToFloatVect<signed char>       (view, items); break;
+		case 'B': result = CopyBufferToFloatVect<unsigned char>     (view, items); break;
+		case 'h': result = CopyBufferToFloatVect<short>             (view, items); break;
+		case 'H': result = CopyBufferToFloatVect<unsigned short>    (view, items); break;
+		case 'i': result = CopyBufferToFloatVect<int>               (view, items); break;
+		case 'I': result = CopyBufferToFloatVect<unsigned int>      (view, items); break;
+		case 'l': result = CopyBufferToFloatVect<long>              (view, items); break;
+		case 'L': result = CopyBufferToFloatVect<unsigned long>     (view, items); break;
+		case 'q': result = CopyBufferToFloatVect<long long>         (view, items); break;
+		case 'Q': result = CopyBufferToFloatVect<unsigned long long>(view, items); break;
+		default:  break;
+		}
+
+		if (!result)
+			items.clear();
+
+		PyBuffer_Release(&view);
+		return result;
+	}
+
+	std::vector<float> mvPythonTranslator::ToFloatVect(PyObject* value, const std::string& message, bool* valid)
 	{
 
 		std::vector<float> items;
 		mvGlobalIntepreterLock gil;
 
+		// see ToStringVect
+		if (valid)
+			*valid = true;
+
+		// fast path for numpy arrays, array.array, memoryview, etc.
+		if (!PyTuple_Check(value) && !PyList_Check(value) && PyObject_CheckBuffer(value))
+		{
+			if (!BufferToFloatVect(value, items))
+			{
+				ThrowPythonException(message + " Buffers must be contiguous and numeric.");
+				if (valid)
+					*valid = false;
+			}
+			return items;
+		}
+
 		if (PyTuple_Check(value))
 		{
 			for (size_t i = 0; i < PyTuple_Size(value); i++)
@@ -254,18 +366,158 @@ namespace Marvel {
 		}
 
 		else
+		{
 			ThrowPythonException(message);
+			if (valid)
+				*valid = false;
+		}
 
 
 		return items;
 	}
 
-	std::vector<std::string> mvPythonTranslator::ToStringVect(PyObject* value, const std::string& message)
+	// Checks that format is a printf style format with exactly one numeric
+	// conversion. Integer conversions are rewritten to take a long long.
+	// Returns 'i' or 'f' for the conversion type, 0 if the format is invalid.
+	static char PrepareBufferFormat(const char* format, std::string& result)
+	{
+		char type = 0;
+		result.clear();
+
+		for (const char* c = format; *c; c++)
+		{
+			result.push_back(*c);
+			if (*c != '%')
+				continue;
+
+			c++;
+			if (*c == '%')
+			{
+				result.push_back(*c);
+				continue;
+			}
+
+			// only one conversion allowed
+			if (type != 0)
+				return 0;
+
+			while (*c && strchr("-+ #0123456789.", *c))
+				result.push_back(*c++);
+
+			if (*c && strchr("diouxX", *c))
+			{
+				result += "ll";
+				type = 'i';
+			}
+			else if (*c && strchr("eEfFgGaA", *c))
+				type = 'f';
+			else
+				return 0;
+
+			result.push_back(*c);
+		}
+
+		return type;
+	}
+
+	template<typename T>
+	static bool CopyBufferToStringVect(const Py_buffer& view, std::vector<std::string>& items, const std::string& format, char type)
+	{
+		if (view.itemsize != (Py_ssize_t)sizeof(T))
+			return false;
+
+		auto data = static_cast<const T*>(view.buf);
+		items.resize(view.len / view.itemsize);
+
+		char buffer[64];
+		for (size_t i = 0; i < items.size(); i++)
+		{
+			int length;
+			if (type == 'f')
+				length = snprintf(buffer, sizeof(buffer), format.c_str(), (double)data[i]);
+
+			// floats that don't fit an integer conversion (nan, inf, out of
+			// range) are shown as is
+			else if constexpr (std::is_floating_point_v<T>)
+			{
+				if (std::isfinite(data[i]) && data[i] >= -9.2e18 && data[i] <= 9.2e18)
+					length = snprintf(buffer, sizeof(buffer), format.c_str(), (long long)data[i]);
+				else
+					length = snprintf(buffer, sizeof(buffer), "%g", (double)data[i]);
+			}
+
+			else
+				length = snprintf(buffer, sizeof(buffer), format.c_str(), (long long)data[i]);
+
+			items[i].assign(buffer, length < 0 ? 0 : std::min((size_t)length, sizeof(buffer) - 1));
+		}
+
+		return true;
+	}
+
+	static bool BufferToStringVect(PyObject* value, std::vector<std::string>& items, const std::string& format)
+	{
+		Py_buffer view;
+		if (PyObject_GetBuffer(value, &view, PyBUF_CONTIG_RO | PyBUF_FORMAT) != 0)
+		{
+			PyErr_Clear();
+			return false;
+		}
+
+		char code = BufferFormatCode(view);
+		bool floating = code == 'f' || code == 'd';
+
+		std::string cellFormat;
+		char type = PrepareBufferFormat(format.empty() ? (floating ? "%g" : "%d") : format.c_str(), cellFormat);
+
+		bool result = type != 0;
+		if (result)
+		{
+			switch (code)
+			{
+			case 'f': result = CopyBufferToStringVect<float>             (view, items, cellFormat, type); break;
+			case 'd': result = CopyBufferToStringVect<double>            (view, items, cellFormat, type); break;
+			case 'b': result = CopyBufferToStringVect<signed char>       (view, items, cellFormat, type); break;
+			case 'B': result = CopyBufferToStringVect<unsigned char>     (view, items, cellFormat, type); break;
+			case 'h': result = CopyBufferToStringVect<short>             (view, items, cellFormat, type); break;
+			case 'H': result = CopyBufferToStringVect<unsigned short>    (view, items, cellFormat, type); break;
+			case 'i': result = CopyBufferToStringVect<int>               (view, items, cellFormat, type); break;
+			case 'I': result = CopyBufferToStringVect<unsigned int>      (view, items, cellFormat, type); break;
+			case 'l': result = CopyBufferToStringVect<long>              (view, items, cellFormat, type); break;
+			case 'L': result = CopyBufferToStringVect<unsigned long>     (view, items, cellFormat, type); break;
+			case 'q': result = CopyBufferToStringVect<long long>         (view, items, cellFormat, type); break;
+			case 'Q': result = CopyBufferToStringVect<unsigned long long>(view, items, cellFormat, type); break;
+			default:  result = false;
+			}
+		}
+
+		PyBuffer_Release(&view);
+		return result;
+	}
+
+	std::vector<std::string> mvPythonTranslator::ToStringVect(PyObject* value, const std::string& message, const std::string& format, bool* valid)
 	{
 
 		std::vector<std::string> items;
 		mvGlobalIntepreterLock gil;
 
+		// the python error is printed and cleared by ThrowPythonException
+		// so callers that need to know check valid instead
+		if (valid)
+			*valid = true;
+
+		// fast path for numpy arrays, array.array, memoryview, etc.
+		if (!PyTuple_Check(value) && !PyList_Check(value) && !PyBytes_Check(value) && PyObject_CheckBuffer(value))
+		{
+			if (!BufferToStringVect(value, items, format))
+			{
+				ThrowPythonException(message + " Buffers must be contiguous and numeric with a single numeric format conversion.");
+				if (valid)
+					*valid = false;
+			}
+			return items;
+		}
+
 		if (PyTuple_Check(value))
 		{
 			for (size_t i = 0; i < PyTuple_Size(value); i++)
@@ -299,7 +551,11 @@ namespace Marvel {
 		}
 
 		else
+		{
 			ThrowPythonException(message);
+			if (valid)
+				*valid = false;
+		}
 
 
 		return items;
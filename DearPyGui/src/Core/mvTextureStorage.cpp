@@ -1,16 +1,46 @@
 #include "mvTextureStorage.h"
 #include "Core/mvUtilities.h"
+#include "Core/mvThreadPool.h"
+#include "Core/mvProfiler.h"
+#include "mvApp.h"
+#include <stb_image.h>
+#include <algorithm>
 
 namespace Marvel {
 
-	std::map<std::string, mvTexture> mvTextureStorage::s_textures;
+	std::map<std::string, mvTexture>             mvTextureStorage::s_textures;
+	mvThreadPool*                                mvTextureStorage::s_decoder = nullptr;
+	std::mutex                                   mvTextureStorage::s_mutex;
+	std::vector<mvTextureStorage::DecodedImage>  mvTextureStorage::s_decoded;
+	std::deque<mvTextureStorage::DecodedImage>   mvTextureStorage::s_uploads;
+	std::atomic<size_t>                          mvTextureStorage::s_uploadBudget{ 16 * 1024 * 1024 };
+	std::atomic<size_t>                          mvTextureStorage::s_memoryBudget{ 256 * 1024 * 1024 };
+	std::list<std::string>                       mvTextureStorage::s_unused;
+	mvTextureStats                               mvTextureStorage::s_stats;
 
 	void mvTextureStorage::DeleteAllTextures()
 	{
+		// waits for decodes in progress
+		delete s_decoder;
+		s_decoder = nullptr;
+
+		for (auto& image : s_decoded)
+			stbi_image_free(image.data);
+		s_decoded.clear();
+
+		for (auto& image : s_uploads)
+			stbi_image_free(image.data);
+		s_uploads.clear();
+
 		for (auto& texture : s_textures)
-			UnloadTexture(texture.first);
+		{
+			if (texture.second.texture)
+				Unload(texture.first, texture.second);
+		}
 
 		s_textures.clear();
+		s_unused.clear();
+		s_stats.unused = 0;
 	}
 
 	void mvTextureStorage::AddTexture(const std::string& name)
@@ -21,15 +51,106 @@ namespace Marvel {
 		if (texture)
 		{
 			IncrementTexture(name);
+			s_stats.hits++;
 			return;
 		}
 
-		mvTexture newTexture = { 0, 0, nullptr, 1 };
+		s_stats.misses++;
+
+		mvTexture newTexture;
+		newTexture.count = 1;
+		s_textures.insert({ name, newTexture });
+
+		if (s_decoder == nullptr)
+		{
+			unsigned threads = std::thread::hardware_concurrency();
+			s_decoder = new mvThreadPool(std::clamp(threads / 2, 1u, 4u));
+		}
+
+		s_decoder->submit([name]() { Decode(name); });
+	}
+
+	void mvTextureStorage::Decode(const std::string& name)
+	{
+		DecodedImage image;
+		image.name = name;
+		image.data = stbi_load(name.c_str(), &image.width, &image.height, nullptr, 4);
 
-		if (LoadTextureFromFile(name.c_str(), newTexture)) {
-            s_textures.insert({ name, newTexture });
-        }
+		{
+			std::lock_guard<std::mutex> lock(s_mutex);
+			s_decoded.push_back(image);
+		}
 
+		// uploaded on the next frame
+		mvApp::GetApp()->requestRedraw();
+	}
+
+	void mvTextureStorage::UpdateTextures()
+	{
+		{
+			std::lock_guard<std::mutex> lock(s_mutex);
+			for (auto& image : s_decoded)
+				s_uploads.push_back(image);
+			s_decoded.clear();
+		}
+
+		// before anything is drawn this frame
+		Evict();
+
+		if (s_uploads.empty())
+			return;
+
+		MV_PROFILE_SCOPE("texture uploads");
+
+		// at least one image is uploaded per frame, even if over budget
+		size_t budget = s_uploadBudget;
+		size_t uploaded = 0;
+		while (!s_uploads.empty() && (uploaded == 0 || uploaded < budget))
+		{
+			DecodedImage image = s_uploads.front();
+			s_uploads.pop_front();
+
+			// released while decoding or already uploaded (released and added again)
+			auto texture = s_textures.find(image.name);
+			if (texture == s_textures.end() || texture->second.texture != nullptr)
+			{
+				stbi_image_free(image.data);
+				continue;
+			}
+
+			if (image.data && LoadTextureFromArray(image.name, image.data, image.width, image.height, texture->second))
+			{
+				s_stats.count++;
+				s_stats.bytes += (size_t)image.width * (size_t)image.height * 4;
+			}
+			else
+				texture->second.failed = true;
+
+			stbi_image_free(image.data);
+			uploaded += (size_t)image.width * (size_t)image.height * 4;
+		}
+	}
+
+	void mvTextureStorage::Unload(const std::string& name, mvTexture& texture)
+	{
+		UnloadTexture(name, texture);
+		texture.texture = nullptr;
+		s_stats.count--;
+		s_stats.bytes -= (size_t)texture.width * (size_t)texture.height * 4;
+	}
+
+	void mvTextureStorage::Evict()
+	{
+		while (s_stats.bytes > s_memoryBudget && !s_unused.empty())
+		{
+			std::string name = s_unused.front();
+			s_unused.pop_front();
+			s_stats.unused--;
+			s_stats.evictions++;
+
+			Unload(name, s_textures.at(name));
+			s_textures.erase(name);
+		}
 	}
 
 	void mvTextureStorage::IncrementTexture(const std::string& name)
@@ -38,7 +159,16 @@ namespace Marvel {
 		if (s_textures.count(name) == 0)
 			return;
 
-		s_textures.at(name).count++;
+		mvTexture& texture = s_textures.at(name);
+
+		// reused before being evicted
+		if (texture.count == 0)
+		{
+			s_unused.erase(texture.unused);
+			s_stats.unused--;
+		}
+
+		texture.count++;
 
 	}
 
@@ -48,14 +178,25 @@ namespace Marvel {
 		if (s_textures.count(name) == 0)
 			return;
 
-		s_textures.at(name).count--;
+		mvTexture& texture = s_textures.at(name);
+		if (texture.count == 0)
+			return;
 
-		// remove if count reaches 0
-		if (s_textures.at(name).count == 0)
+		texture.count--;
+
+		if (texture.count > 0)
+			return;
+
+		// uploaded textures are kept until evicted by UpdateTextures (the
+		// current frame may still draw them), pending or failed ones are
+		// removed and a pending upload is skipped
+		if (texture.texture)
 		{
-			UnloadTexture(name);
-			s_textures.erase(name);
+			texture.unused = s_unused.insert(s_unused.end(), name);
+			s_stats.unused++;
 		}
+		else
+			s_textures.erase(name);
 	}
 
 	mvTexture* mvTextureStorage::GetTexture(const std::string& name)
@@ -72,4 +213,4 @@ namespace Marvel {
 		return s_textures.size();
 	}
 
-}
\ No newline at end of file
+}
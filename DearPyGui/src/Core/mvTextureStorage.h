@@ -3,7 +3,7 @@
 //-----------------------------------------------------------------------------
 // mvTextureStorage
 //
-//     - This class acts as a manager for texture storage. The 
+//     - This class acts as a manager for texture storage. The
 //       texture storage system serves 2 purposes:
 //
 //         * Allows some image based widgets to share the same textures.
@@ -11,14 +11,29 @@
 //           a reference counting system.
 //
 //     - AddTexture will increment an existing texture if it already exists
-//     
+//
+//     - Images are decoded on worker threads. UpdateTextures uploads the
+//       decoded images once per frame, up to a byte budget, so a texture
+//       is not ready (texture is null) for a few frames after AddTexture.
+//
+//     - Textures whose count reaches 0 stay on the GPU and are reused by
+//       AddTexture until the memory budget is exceeded, then the least
+//       recently released are unloaded first.
+//
 //-----------------------------------------------------------------------------
 
 #include <string>
 #include <map>
+#include <deque>
+#include <list>
+#include <vector>
+#include <mutex>
+#include <atomic>
 
 namespace Marvel {
 
+	class mvThreadPool;
+
 	//-----------------------------------------------------------------------------
 	// mvTexture
 	//-----------------------------------------------------------------------------
@@ -26,8 +41,24 @@ namespace Marvel {
 	{
 		int   width = 0;
 		int   height = 0;
-		void* texture = nullptr;
+		void* texture = nullptr; // null until uploaded
 		int   count = 0;
+		bool  failed = false;    // image could not be loaded
+
+		std::list<std::string>::iterator unused; // position in the eviction list while count is 0
+	};
+
+	//-----------------------------------------------------------------------------
+	// mvTextureStats
+	//-----------------------------------------------------------------------------
+	struct mvTextureStats
+	{
+		unsigned count = 0;      // textures on the GPU, including unused
+		unsigned unused = 0;     // textures on the GPU with a count of 0
+		size_t   bytes = 0;      // GPU memory used by textures
+		unsigned hits = 0;       // AddTexture found the texture already loaded
+		unsigned misses = 0;     // AddTexture had to load the texture
+		unsigned evictions = 0;  // unused textures unloaded to stay in budget
 	};
 
 	//-----------------------------------------------------------------------------
@@ -36,6 +67,14 @@ namespace Marvel {
 	class mvTextureStorage
 	{
 
+		struct DecodedImage
+		{
+			std::string    name;
+			unsigned char* data = nullptr; // null if decoding failed
+			int            width = 0;
+			int            height = 0;
+		};
+
 	public:
 
 		static void       AddTexture       (const std::string& name);
@@ -45,12 +84,35 @@ namespace Marvel {
 		static unsigned   GetTextureCount  ();
 		static void       DeleteAllTextures();
 
+		// uploads decoded images, called once per frame by mvApp
+		static void       UpdateTextures   ();
+		static bool       HasPendingUploads() { return !s_uploads.empty(); }
+		static void       SetUploadBudget  (size_t bytes) { s_uploadBudget = bytes; }
+		static size_t     GetUploadBudget  () { return s_uploadBudget; }
+
+		// GPU memory kept for textures, only unused textures are evicted
+		static void       SetMemoryBudget  (size_t bytes) { s_memoryBudget = bytes; }
+		static size_t     GetMemoryBudget  () { return s_memoryBudget; }
+		static const mvTextureStats& GetStats() { return s_stats; }
+
 	private:
 
 		mvTextureStorage() = default;
-		
+
+		static void Decode(const std::string& name);
+		static void Unload(const std::string& name, mvTexture& texture);
+		static void Evict ();
+
 		static std::map<std::string, mvTexture> s_textures;
+		static mvThreadPool*                    s_decoder;      // created on first use
+		static std::mutex                       s_mutex;        // guards s_decoded
+		static std::vector<DecodedImage>        s_decoded;      // written by the decoder threads
+		static std::deque<DecodedImage>         s_uploads;      // waiting for upload budget
+		static std::atomic<size_t>              s_uploadBudget; // bytes uploaded per frame, set from any thread
+		static std::atomic<size_t>              s_memoryBudget; // applied by UpdateTextures
+		static std::list<std::string>           s_unused;       // count is 0, least recently released first
+		static mvTextureStats                   s_stats;
 
 	};
 
-}
\ No newline at end of file
+}
@@ -18,6 +18,9 @@
 #include <vector>
 #include <queue>
 #include <deque>
+#include <algorithm>
+#include <thread>
+#include <cstdint>
 
 namespace Marvel {
 
@@ -188,6 +191,10 @@ namespace Marvel {
     //-----------------------------------------------------------------------------
     class mvFunctionWrapper
     {
+        // the lock-free queues store the implementation pointer directly
+        friend class mvWorkStealingQueue;
+        friend class mvRingQueue;
+
         struct impl_base {
             virtual void call() = 0;
             virtual ~impl_base() = default;
@@ -238,57 +245,210 @@ namespace Marvel {
 
     //-----------------------------------------------------------------------------
     // mvWorkStealingQueue
+    //     - Bounded lock-free Chase-Lev deque. Only the owning thread may push
+    //       and pop (LIFO), any thread may steal (FIFO).
     //-----------------------------------------------------------------------------
     class mvWorkStealingQueue
     {
 
+        typedef mvFunctionWrapper::impl_base* slot_type;
+
     public:
 
-        mvWorkStealingQueue() {}
-        ~mvWorkStealingQueue() = default;
+        // capacity must be a power of 2
+        explicit mvWorkStealingQueue(size_t capacity = 1024)
+            : m_slots(new std::atomic<slot_type>[capacity]), m_mask((std::int64_t)capacity - 1)
+        {
+
+        }
+
+        ~mvWorkStealingQueue()
+        {
+            for (std::int64_t i = m_top; i < m_bottom; i++)
+                delete m_slots[i & m_mask].load(std::memory_order_relaxed);
+        }
 
         // deleted copy constructor/assignment operator.
         mvWorkStealingQueue(const mvWorkStealingQueue& other) = delete;
         mvWorkStealingQueue& operator=(const mvWorkStealingQueue& other) = delete;
 
-        void push(mvFunctionWrapper data)
+        // returns false (leaving data untouched) if the deque is full
+        bool push(mvFunctionWrapper& data)
         {
-            std::lock_guard<std::mutex> lock(m_mutex);
-            m_queue.push_front(std::move(data));
+            std::int64_t bottom = m_bottom.load(std::memory_order_relaxed);
+            std::int64_t top = m_top.load(std::memory_order_acquire);
+            if (bottom - top > m_mask)
+                return false;
+
+            m_slots[bottom & m_mask].store(data.m_impl.release(), std::memory_order_relaxed);
+            std::atomic_thread_fence(std::memory_order_release);
+            m_bottom.store(bottom + 1, std::memory_order_relaxed);
+            return true;
         }
 
         bool empty() const
         {
-            std::lock_guard<std::mutex> lock(m_mutex);
-            return m_queue.empty();
+            return m_bottom.load(std::memory_order_relaxed) <= m_top.load(std::memory_order_relaxed);
         }
 
         bool try_pop(mvFunctionWrapper& res)
         {
-            std::lock_guard<std::mutex> lock(m_mutex);
-            if (m_queue.empty())
+            std::int64_t bottom = m_bottom.load(std::memory_order_relaxed) - 1;
+            m_bottom.store(bottom, std::memory_order_relaxed);
+            std::atomic_thread_fence(std::memory_order_seq_cst);
+            std::int64_t top = m_top.load(std::memory_order_relaxed);
+
+            if (top > bottom)
+            {
+                m_bottom.store(bottom + 1, std::memory_order_relaxed);
                 return false;
+            }
+
+            slot_type item = m_slots[bottom & m_mask].load(std::memory_order_relaxed);
+
+            // last item, race stealers for it
+            if (top == bottom)
+            {
+                bool won = m_top.compare_exchange_strong(top, top + 1,
+                    std::memory_order_seq_cst, std::memory_order_relaxed);
+                m_bottom.store(bottom + 1, std::memory_order_relaxed);
+                if (!won)
+                    return false;
+            }
 
-            res = std::move(m_queue.front());
-            m_queue.pop_front();
+            res.m_impl.reset(item);
             return true;
         }
 
         bool try_steal(mvFunctionWrapper& res)
         {
-            std::lock_guard<std::mutex> lock(m_mutex);
-            if (m_queue.empty())
+            std::int64_t top = m_top.load(std::memory_order_acquire);
+            std::atomic_thread_fence(std::memory_order_seq_cst);
+            std::int64_t bottom = m_bottom.load(std::memory_order_acquire);
+
+            if (top >= bottom)
+                return false;
+
+            slot_type item = m_slots[top & m_mask].load(std::memory_order_relaxed);
+            if (!m_top.compare_exchange_strong(top, top + 1,
+                std::memory_order_seq_cst, std::memory_order_relaxed))
                 return false;
 
-            res = std::move(m_queue.back());
-            m_queue.pop_back();
+            res.m_impl.reset(item);
+            return true;
+        }
+
+    private:
+
+        // top and bottom are on separate cache lines since thieves only
+        // write top and the owner mostly writes bottom
+        alignas(64) std::atomic<std::int64_t>      m_top{ 0 };
+        alignas(64) std::atomic<std::int64_t>      m_bottom{ 0 };
+        std::unique_ptr<std::atomic<slot_type>[]> m_slots;
+        const std::int64_t                         m_mask;
+
+    };
+
+    //-----------------------------------------------------------------------------
+    // mvRingQueue
+    //     - Bounded lock-free multi producer/multi consumer queue where each
+    //       slot carries a sequence number telling producers and consumers
+    //       whose turn it is.
+    //-----------------------------------------------------------------------------
+    class mvRingQueue
+    {
+
+        struct cell
+        {
+            std::atomic<size_t>             sequence;
+            mvFunctionWrapper::impl_base*   data;
+        };
+
+    public:
+
+        // capacity must be a power of 2
+        explicit mvRingQueue(size_t capacity = 4096)
+            : m_cells(new cell[capacity]), m_mask(capacity - 1)
+        {
+            for (size_t i = 0; i < capacity; i++)
+                m_cells[i].sequence.store(i, std::memory_order_relaxed);
+        }
+
+        ~mvRingQueue()
+        {
+            mvFunctionWrapper task;
+            while (try_pop(task)) {}
+        }
+
+        // deleted copy constructor/assignment operator.
+        mvRingQueue(const mvRingQueue& other) = delete;
+        mvRingQueue& operator=(const mvRingQueue& other) = delete;
+
+        // returns false (leaving data untouched) if the queue is full
+        bool push(mvFunctionWrapper& data)
+        {
+            size_t pos = m_enqueue.load(std::memory_order_relaxed);
+            cell* target;
+
+            while (true)
+            {
+                target = &m_cells[pos & m_mask];
+                size_t sequence = target->sequence.load(std::memory_order_acquire);
+                std::intptr_t diff = (std::intptr_t)sequence - (std::intptr_t)pos;
+
+                if (diff == 0)
+                {
+                    if (m_enqueue.compare_exchange_weak(pos, pos + 1, std::memory_order_relaxed))
+                        break;
+                }
+
+                else if (diff < 0)
+                    return false;
+
+                else
+                    pos = m_enqueue.load(std::memory_order_relaxed);
+            }
+
+            target->data = data.m_impl.release();
+            target->sequence.store(pos + 1, std::memory_order_release);
+            return true;
+        }
+
+        bool try_pop(mvFunctionWrapper& res)
+        {
+            size_t pos = m_dequeue.load(std::memory_order_relaxed);
+            cell* target;
+
+            while (true)
+            {
+                target = &m_cells[pos & m_mask];
+                size_t sequence = target->sequence.load(std::memory_order_acquire);
+                std::intptr_t diff = (std::intptr_t)sequence - (std::intptr_t)(pos + 1);
+
+                if (diff == 0)
+                {
+                    if (m_dequeue.compare_exchange_weak(pos, pos + 1, std::memory_order_relaxed))
+                        break;
+                }
+
+                else if (diff < 0)
+                    return false;
+
+                else
+                    pos = m_dequeue.load(std::memory_order_relaxed);
+            }
+
+            res.m_impl.reset(target->data);
+            target->sequence.store(pos + m_mask + 1, std::memory_order_release);
             return true;
         }
 
     private:
 
-        std::deque<mvFunctionWrapper> m_queue;
-        mutable std::mutex            m_mutex;
+        alignas(64) std::atomic<size_t> m_enqueue{ 0 };
+        alignas(64) std::atomic<size_t> m_dequeue{ 0 };
+        std::unique_ptr<cell[]>         m_cells;
+        const size_t                    m_mask;
 
     };
 
@@ -329,9 +489,16 @@ namespace Marvel {
             }
         }
 
-        ~mvThreadPool() { m_done = true; }
+        ~mvThreadPool()
+        {
+            m_done = true;
+
+            // wake parked workers so they can exit before being joined
+            std::lock_guard<std::mutex> lock(m_wake_mutex);
+            m_wake_cond.notify_all();
+        }
 
-        static const char* getVersion() { return "v0.2"; }
+        static const char* getVersion() { return "v0.4"; }
 
         template<typename F, typename ...Args>
         std::future<typename std::invoke_result<F, Args...>::type> submit(F f)
@@ -339,10 +506,24 @@ namespace Marvel {
             typedef typename std::invoke_result<F, Args...>::type result_type;
             std::packaged_task<result_type()> task(std::move(f));
             std::future<result_type> res(task.get_future());
-            if (m_local_work_queue)
-                m_local_work_queue->push(std::move(task));
-            else
-                m_pool_work_queue.push(std::move(task));
+            task_type wrapper(std::move(task));
+
+            // the bounded queues spill into the locking overflow queue
+            if (!(m_local_pool == this && m_local_work_queue->push(wrapper)) &&
+                !m_pool_work_queue.push(wrapper))
+            {
+                m_overflow_work_queue.push(std::move(wrapper));
+                m_overflow++;
+            }
+
+            // the pending count must be published before checking for parked
+            // workers (see park)
+            m_pending++;
+            if (m_parked > 0)
+            {
+                std::lock_guard<std::mutex> lock(m_wake_mutex);
+                m_wake_cond.notify_one();
+            }
 
             return res;
         }
@@ -353,34 +534,81 @@ namespace Marvel {
         {
             m_index = index;
 
+            m_local_pool = this;
             m_local_work_queue = m_queues[m_index].get();
 
+            unsigned spin_limit = s_min_spin;
+            unsigned spins = 0;
+
             while (!m_done)
-                run_pending_task();
+            {
+                if (run_pending_task())
+                {
+                    // work arrived while spinning, so spin longer next time
+                    if (spins > 0)
+                        spin_limit = std::min(spin_limit * 2, s_max_spin);
+                    spins = 0;
+                }
+
+                else if (spins < spin_limit)
+                {
+                    spins++;
+                    std::this_thread::yield();
+                }
+
+                else
+                {
+                    // spinning did not pay off, so give up sooner next time
+                    spin_limit = std::max(spin_limit / 2, s_min_spin);
+                    spins = 0;
+                    park();
+                }
+            }
         }
 
-        void run_pending_task()
+        bool run_pending_task()
         {
             task_type task;
             if (pop_task_from_local_queue(task) ||
                 pop_task_from_pool_queue(task) ||
                 pop_task_from_other_thread_queue(task))
             {
+                m_pending--;
                 task();
+                return true;
             }
 
-            else
-                std::this_thread::yield();
+            return false;
+        }
+
+        // Blocks until a task is submitted or the pool is destroyed. The
+        // parked count is raised before the pending count is checked while
+        // submit does the reverse, so one of them always sees the other.
+        void park()
+        {
+            std::unique_lock<std::mutex> lock(m_wake_mutex);
+            m_parked++;
+            m_wake_cond.wait(lock, [&] {return m_done || m_pending > 0; });
+            m_parked--;
         }
 
         bool pop_task_from_local_queue(task_type& task)
         {
-            return m_local_work_queue && m_local_work_queue->try_pop(task);
+            return m_local_pool == this && m_local_work_queue->try_pop(task);
         }
 
         bool pop_task_from_pool_queue(task_type& task)
         {
-            return m_pool_work_queue.try_pop(task);
+            if (m_pool_work_queue.try_pop(task))
+                return true;
+
+            if (m_overflow > 0 && m_overflow_work_queue.try_pop(task))
+            {
+                m_overflow--;
+                return true;
+            }
+
+            return false;
         }
 
         bool pop_task_from_other_thread_queue(task_type& task)
@@ -397,16 +625,28 @@ namespace Marvel {
 
     private:
 
+        // yields a worker makes without finding work before parking
+        static constexpr unsigned s_min_spin = 16;
+        static constexpr unsigned s_max_spin = 1024;
+
         std::atomic_bool                                   m_done;
-        mvQueue<task_type>                                 m_pool_work_queue;
+        std::atomic_int                                    m_pending{ 0 };
+        std::atomic_int                                    m_parked{ 0 };
+        std::mutex                                         m_wake_mutex;
+        std::condition_variable                            m_wake_cond;
+        mvRingQueue                                        m_pool_work_queue;
+        mvQueue<task_type>                                 m_overflow_work_queue;
+        std::atomic_int                                    m_overflow{ 0 };
         std::vector<std::unique_ptr<mvWorkStealingQueue> > m_queues;
         std::vector<std::thread>                           m_threads;
         mvThreadJoiner                                     m_joiner;
-        static thread_local mvWorkStealingQueue*           m_local_work_queue;
-        static thread_local unsigned                       m_index;
+
+        // set on worker threads only, several pools (the app's and the
+        // texture decoder) share these so the owning pool is kept too
+        inline static thread_local mvThreadPool*           m_local_pool = nullptr;
+        inline static thread_local mvWorkStealingQueue*    m_local_work_queue = nullptr;
+        inline static thread_local unsigned                m_index = 0;
 
     };
 
-    thread_local mvWorkStealingQueue* mvThreadPool::m_local_work_queue;
-    thread_local unsigned mvThreadPool::m_index;
 }
\ No newline at end of file
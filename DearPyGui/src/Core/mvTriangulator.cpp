@@ -0,0 +1,222 @@
+#include "mvTriangulator.h"
+#include <algorithm>
+#include <cmath>
+
+namespace Marvel {
+
+	// twice the signed area of triangle abc
+	static double Orient(const ImVec2& a, const ImVec2& b, const ImVec2& c)
+	{
+		return ((double)b.x - a.x) * ((double)c.y - a.y) - ((double)b.y - a.y) * ((double)c.x - a.x);
+	}
+
+	bool TriangulatePolygon(const std::vector<ImVec2>& points, std::vector<unsigned>& indices)
+	{
+		indices.clear();
+
+		auto count = (unsigned)points.size();
+		if (count < 3)
+			return false;
+
+		// winding and bounds
+		double area = 0.0;
+		ImVec2 bmin = points[0];
+		ImVec2 bmax = points[0];
+		for (unsigned i = 0, j = count - 1; i < count; j = i++)
+		{
+			area += (double)points[j].x * points[i].y - (double)points[i].x * points[j].y;
+			bmin.x = std::min(bmin.x, points[i].x);
+			bmin.y = std::min(bmin.y, points[i].y);
+			bmax.x = std::max(bmax.x, points[i].x);
+			bmax.y = std::max(bmax.y, points[i].y);
+		}
+
+		if (area == 0.0 || std::isnan(area))
+			return false;
+
+		// ears are triangles with the same winding as the polygon
+		double sign = area > 0.0 ? 1.0 : -1.0;
+
+		std::vector<unsigned> prev(count);
+		std::vector<unsigned> next(count);
+		std::vector<char> reflex(count, 0);
+		for (unsigned i = 0; i < count; i++)
+		{
+			prev[i] = i == 0 ? count - 1 : i - 1;
+			next[i] = i == count - 1 ? 0 : i + 1;
+		}
+
+		auto isReflex = [&](unsigned i)
+		{
+			return sign * Orient(points[prev[i]], points[i], points[next[i]]) < 0.0;
+		};
+
+		// only reflex vertices can be inside an ear so they are bucketed in a
+		// grid, keeping ear tests local instead of checking every vertex
+		unsigned cells = std::max(1u, (unsigned)std::sqrt((double)count) / 2u);
+		float cellWidth = (bmax.x - bmin.x) / (float)cells;
+		float cellHeight = (bmax.y - bmin.y) / (float)cells;
+		std::vector<std::vector<unsigned>> grid(cells * cells);
+
+		auto cell = [cells](float value, float origin, float size)
+		{
+			if (size <= 0.0f)
+				return 0u;
+			int index = (int)((value - origin) / size);
+			return (unsigned)std::clamp(index, 0, (int)cells - 1);
+		};
+
+		auto addReflex = [&](unsigned i)
+		{
+			reflex[i] = 1;
+			grid[cell(points[i].y, bmin.y, cellHeight) * cells + cell(points[i].x, bmin.x, cellWidth)].push_back(i);
+		};
+
+		for (unsigned i = 0; i < count; i++)
+		{
+			if (isReflex(i))
+				addReflex(i);
+		}
+
+		auto isEar = [&](unsigned i)
+		{
+			const ImVec2& a = points[prev[i]];
+			const ImVec2& b = points[i];
+			const ImVec2& c = points[next[i]];
+
+			unsigned xmin = cell(std::min({ a.x, b.x, c.x }), bmin.x, cellWidth);
+			unsigned xmax = cell(std::max({ a.x, b.x, c.x }), bmin.x, cellWidth);
+			unsigned ymin = cell(std::min({ a.y, b.y, c.y }), bmin.y, cellHeight);
+			unsigned ymax = cell(std::max({ a.y, b.y, c.y }), bmin.y, cellHeight);
+
+			for (unsigned y = ymin; y <= ymax; y++)
+			{
+				for (unsigned x = xmin; x <= xmax; x++)
+				{
+					for (unsigned v : grid[y * cells + x])
+					{
+						// removed vertices and vertices that became convex stay in the grid
+						if (!reflex[v] || v == prev[i] || v == i || v == next[i])
+							continue;
+
+						const ImVec2& p = points[v];
+						if ((p.x == a.x && p.y == a.y) || (p.x == b.x && p.y == b.y) || (p.x == c.x && p.y == c.y))
+							continue;
+
+						if (sign * Orient(a, b, p) >= 0.0 && sign * Orient(b, c, p) >= 0.0 && sign * Orient(c, a, p) >= 0.0)
+							return false;
+					}
+				}
+			}
+
+			return true;
+		};
+
+		indices.reserve((size_t)(count - 2) * 3);
+
+		bool simple = true;
+		unsigned remaining = count;
+		unsigned i = 0;
+		unsigned stall = 0;
+
+		while (remaining > 3)
+		{
+			unsigned a = prev[i];
+			unsigned c = next[i];
+			double orientation = sign * Orient(points[a], points[i], points[c]);
+
+			// collinear vertices are dropped without a triangle, after a full
+			// pass without finding an ear the polygon is not simple so the
+			// next convex vertex is clipped regardless
+			bool clip = orientation == 0.0;
+			if (!clip && orientation > 0.0)
+				clip = stall > remaining || isEar(i);
+
+			if (!clip)
+			{
+				// nothing left to clip (i.e. nan coordinates)
+				if (++stall > 2 * remaining)
+					return false;
+				i = c;
+				continue;
+			}
+
+			if (stall > remaining)
+				simple = false;
+
+			if (orientation != 0.0)
+			{
+				indices.push_back(a);
+				indices.push_back(i);
+				indices.push_back(c);
+			}
+
+			reflex[i] = 0;
+			next[a] = c;
+			prev[c] = a;
+			remaining--;
+
+			// neighbours of a clipped ear can only become convex for simple
+			// polygons, but not simple polygons may create new reflex vertices
+			for (unsigned v : { a, c })
+			{
+				bool isNowReflex = isReflex(v);
+				if (isNowReflex && !reflex[v])
+					addReflex(v);
+				else if (!isNowReflex)
+					reflex[v] = 0;
+			}
+
+			i = a;
+			stall = 0;
+		}
+
+		if (Orient(points[prev[i]], points[i], points[next[i]]) != 0.0)
+		{
+			indices.push_back(prev[i]);
+			indices.push_back(i);
+			indices.push_back(next[i]);
+		}
+
+		return simple;
+	}
+
+	void AddTriangulatedPolygonFilled(ImDrawList* drawlist, const std::vector<ImVec2>& points,
+		const std::vector<unsigned>& indices, ImU32 color, const ImVec2& offset)
+	{
+		if (indices.empty())
+			return;
+
+		const ImVec2 uv = drawlist->_Data->TexUvWhitePixel;
+		constexpr size_t maxVertices = sizeof(ImDrawIdx) == 2 ? 0xFFFF : 0xFFFFFFFF;
+
+		// shared vertices
+		if (points.size() <= maxVertices)
+		{
+			drawlist->PrimReserve((int)indices.size(), (int)points.size());
+			unsigned base = drawlist->_VtxCurrentIdx;
+			for (const auto& point : points)
+				drawlist->PrimWriteVtx(ImVec2(point.x + offset.x, point.y + offset.y), uv, color);
+			for (unsigned index : indices)
+				drawlist->PrimWriteIdx((ImDrawIdx)(base + index));
+			return;
+		}
+
+		// too many vertices for the index type, submit independent triangles
+		// in chunks the index type can address
+		size_t triangles = indices.size() / 3;
+		size_t chunk = maxVertices / 3;
+		for (size_t start = 0; start < triangles; start += chunk)
+		{
+			size_t end = std::min(start + chunk, triangles);
+			drawlist->PrimReserve((int)(end - start) * 3, (int)(end - start) * 3);
+			for (size_t j = start * 3; j < end * 3; j++)
+			{
+				drawlist->PrimWriteIdx((ImDrawIdx)drawlist->_VtxCurrentIdx);
+				const ImVec2& point = points[indices[j]];
+				drawlist->PrimWriteVtx(ImVec2(point.x + offset.x, point.y + offset.y), uv, color);
+			}
+		}
+	}
+
+}
@@ -0,0 +1,28 @@
+#pragma once
+
+//-----------------------------------------------------------------------------
+// mvTriangulator
+//
+//     - Triangulates polygons by ear clipping so polygon fills can be
+//       submitted to a draw list as a single vertex batch.
+//
+//-----------------------------------------------------------------------------
+
+#include <vector>
+#include <imgui.h>
+
+namespace Marvel {
+
+	// Fills indices with 3 indices into points per triangle. Either winding
+	// is accepted. Returns false if the polygon is degenerate or not simple,
+	// in which case the triangles produced are a best effort.
+	bool TriangulatePolygon(const std::vector<ImVec2>& points, std::vector<unsigned>& indices);
+
+	// Submits the triangles as one reservation (split only when the vertex
+	// count exceeds what 16 bit draw indices can address). Points are
+	// translated by offset, so triangles cached relative to a widget can be
+	// submitted wherever the widget is.
+	void AddTriangulatedPolygonFilled(ImDrawList* drawlist, const std::vector<ImVec2>& points,
+		const std::vector<unsigned>& indices, ImU32 color, const ImVec2& offset = ImVec2(0.0f, 0.0f));
+
+}
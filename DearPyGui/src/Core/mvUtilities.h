@@ -14,7 +14,10 @@
 
 namespace Marvel {
 
-	bool        UnloadTexture      (const std::string& filename);
-	bool        LoadTextureFromFile(const char* filename, mvTexture& storage);
+	// releases a texture created by LoadTextureFromArray, main thread only
+	bool        UnloadTexture       (const std::string& filename, const mvTexture& storage);
+
+	// creates a texture from decoded RGBA pixels, main thread only
+	bool        LoadTextureFromArray(const std::string& filename, const unsigned char* data, int width, int height, mvTexture& storage);
 
 }
\ No newline at end of file
@@ -63,6 +63,7 @@ namespace Marvel {
 
 			if (font == nullptr)
 			{
+				mvGlobalIntepreterLock gil;
 				int line = PyFrame_GetLineNumber(PyEval_GetFrame());
 				PyErr_Format(PyExc_Exception,
 					"Font file %s could not be found.  %d c", mvApp::GetApp()->m_fontFile.c_str(), line);
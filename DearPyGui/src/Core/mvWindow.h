@@ -40,6 +40,7 @@ namespace Marvel {
 		virtual void postrender () {}
 		virtual void cleanup    () {}
 		virtual void setWindowText(const std::string& name) {}
+		virtual void wakeup       () {} // interrupts an event wait, safe from any thread
 
 		void setupFonts();
 
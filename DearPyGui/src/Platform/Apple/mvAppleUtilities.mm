@@ -16,14 +16,8 @@ static std::vector<std::pair<std::string, id<MTLTexture>>> g_textures;
 
 namespace Marvel {
 
-    bool LoadTextureFromFile(const char* filename, mvTexture& storage)
+    bool LoadTextureFromArray(const std::string& filename, const unsigned char* data, int width, int height, mvTexture& storage)
     {
-        int width, height;
-
-        unsigned char* image_data = stbi_load(filename, &width, &height, nullptr, 4);
-        if (image_data == nullptr)
-            return false;
-
         MTLTextureDescriptor *textureDescriptor = [MTLTextureDescriptor texture2DDescriptorWithPixelFormat:MTLPixelFormatRGBA8Unorm
                                                                                                      width:width
                                                                                                     height:height
@@ -32,7 +26,7 @@ namespace Marvel {
         textureDescriptor.storageMode = MTLStorageModeManaged;
 
         id <MTLTexture> texture = [mvAppleWindow::GetDevice() newTextureWithDescriptor:textureDescriptor];
-        [texture replaceRegion:MTLRegionMake2D(0, 0, width, height) mipmapLevel:0 withBytes:image_data bytesPerRow:width * 4];
+        [texture replaceRegion:MTLRegionMake2D(0, 0, width, height) mipmapLevel:0 withBytes:data bytesPerRow:width * 4];
 
         g_textures.push_back({filename, texture});
 
@@ -43,7 +37,7 @@ namespace Marvel {
         return true;
     }
 
-	bool UnloadTexture(const std::string& filename)
+	bool UnloadTexture(const std::string& filename, const mvTexture& storage)
 	{
         std::vector<std::pair<std::string, id<MTLTexture>>> oldtextures = g_textures;
         g_textures.clear();
@@ -21,6 +21,7 @@ namespace Marvel {
         void renderFrame() override;
         void cleanup    () override;
         void setWindowText(const std::string& name) override;
+        void wakeup       () override;
 
         static id<MTLDevice> GetDevice() { return device; }
 
@@ -1,4 +1,5 @@
 #include "mvAppleWindow.h"
+#include "Core/mvProfiler.h"
 #include <implot.h>
 
 #define GLFW_INCLUDE_NONE
@@ -104,6 +105,11 @@ namespace Marvel {
         glfwSetWindowTitle(m_window, name.c_str());
     }
 
+    void mvAppleWindow::wakeup()
+    {
+        glfwPostEmptyEvent();
+    }
+
     void mvAppleWindow::renderFrame()
     {
         @autoreleasepool {
@@ -112,7 +118,16 @@ namespace Marvel {
             // - When io.WantCaptureMouse is true, do not dispatch mouse input data to your main application.
             // - When io.WantCaptureKeyboard is true, do not dispatch keyboard input data to your main application.
             // Generally you may always pass all inputs to dear imgui, and hide them from your application based on those two flags.
-            glfwPollEvents();
+            double wait = mvApp::GetApp()->getEventWait();
+            if (wait > 0.0)
+            {
+                // glfw doesn't report why the wait ended, returning early means an event
+                double start = glfwGetTime();
+                glfwWaitEventsTimeout(wait);
+                mvApp::GetApp()->endEventWait(glfwGetTime() - start < wait);
+            }
+            else
+                glfwPollEvents();
 
             int width, height;
             glfwGetFramebufferSize(m_window, &width, &height);
@@ -134,6 +149,7 @@ namespace Marvel {
             ImGui_ImplMetal_NewFrame(m_renderPassDescriptor);
             ImGui_ImplGlfw_NewFrame();
             ImGui::NewFrame();
+            mvProfiler::BeginFrame();
 
             if (m_error) {
                 mvAppLog::setSize(m_width, m_height);
@@ -152,15 +168,21 @@ namespace Marvel {
                 m_app->postrender();
             }
 
-            // Rendering
-            ImGui::Render();
-            ImGui_ImplMetal_RenderDrawData(ImGui::GetDrawData(), commandBuffer, m_renderEncoder);
+            {
+                MV_PROFILE_SCOPE("present");
 
-            [m_renderEncoder popDebugGroup];
-            [m_renderEncoder endEncoding];
+                // Rendering
+                ImGui::Render();
+                ImGui_ImplMetal_RenderDrawData(ImGui::GetDrawData(), commandBuffer, m_renderEncoder);
+
+                [m_renderEncoder popDebugGroup];
+                [m_renderEncoder endEncoding];
+
+                [commandBuffer presentDrawable:drawable];
+                [commandBuffer commit];
+            }
 
-            [commandBuffer presentDrawable:drawable];
-            [commandBuffer commit];
+            mvProfiler::EndFrame();
         }
 	}
 
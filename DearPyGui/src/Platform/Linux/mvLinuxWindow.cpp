@@ -1,5 +1,6 @@
 #include "Platform/Linux/mvLinuxWindow.h"
 #include "mvApp.h"
+#include "Core/mvProfiler.h"
 #include "Core/StandardWindows/mvAppEditor.h"
 
 #include <GL/gl3w.h>
@@ -95,9 +96,15 @@ namespace Marvel {
         glfwSetWindowTitle(m_window, name.c_str());
     }
 
+    void mvLinuxWindow::wakeup()
+    {
+        glfwPostEmptyEvent();
+    }
+
     void mvLinuxWindow::renderFrame()
     {
         prerender();
+        mvProfiler::BeginFrame();
 
         if (m_error)
         {
@@ -126,7 +133,12 @@ namespace Marvel {
             m_app->postrender();
         }
 
-        postrender();
+        {
+            MV_PROFILE_SCOPE("present");
+            postrender();
+        }
+
+        mvProfiler::EndFrame();
     }
 
     void mvLinuxWindow::run()
@@ -147,7 +159,16 @@ namespace Marvel {
         // - When io.WantCaptureMouse is true, do not dispatch mouse input data to your main application.
         // - When io.WantCaptureKeyboard is true, do not dispatch keyboard input data to your main application.
         // Generally you may always pass all inputs to dear imgui, and hide them from your application based on those two flags.
-        glfwPollEvents();
+        double wait = mvApp::GetApp()->getEventWait();
+        if (wait > 0.0)
+        {
+            // glfw doesn't report why the wait ended, returning early means an event
+            double start = glfwGetTime();
+            glfwWaitEventsTimeout(wait);
+            mvApp::GetApp()->endEventWait(glfwGetTime() - start < wait);
+        }
+        else
+            glfwPollEvents();
 
         // Start the Dear ImGui frame
         ImGui_ImplOpenGL3_NewFrame();
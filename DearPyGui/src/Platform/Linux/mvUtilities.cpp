@@ -8,17 +8,9 @@
 
 namespace Marvel {
 
-    // Simple helper function to load an image into a DX11 texture with common settings
-    bool LoadTextureFromFile(const char* filename, mvTexture& storage)
+    bool LoadTextureFromArray(const std::string& filename, const unsigned char* data, int width, int height, mvTexture& storage)
     {
 
-        // Load from file
-        int image_width = 0;
-        int image_height = 0;
-        unsigned char* image_data = stbi_load(filename, &image_width, &image_height, nullptr, 4);
-        if (image_data == nullptr)
-            return false;
-
         // Create a OpenGL texture identifier
         GLuint image_texture;
         glGenTextures(1, &image_texture);
@@ -30,21 +22,21 @@ namespace Marvel {
 
         // Upload pixels into texture
         glPixelStorei(GL_UNPACK_ROW_LENGTH, 0);
-        glTexImage2D(GL_TEXTURE_2D, 0, GL_RGBA, image_width, image_height, 0, GL_RGBA, GL_UNSIGNED_BYTE, image_data);
-        stbi_image_free(image_data);
+        glTexImage2D(GL_TEXTURE_2D, 0, GL_RGBA, width, height, 0, GL_RGBA, GL_UNSIGNED_BYTE, data);
 
-        storage.texture = (void *)image_texture;
-        storage.width = image_width;
-        storage.height = image_height;
+        storage.texture = (void *)(intptr_t)image_texture;
+        storage.width = width;
+        storage.height = height;
 
         return true;
     }
 
-    bool UnloadTexture(const std::string& filename)
-	{
-		// TODO : decide if cleanup is necessary
-		return true;
-	}
+    bool UnloadTexture(const std::string& filename, const mvTexture& storage)
+    {
+        GLuint image_texture = (GLuint)(intptr_t)storage.texture;
+        glDeleteTextures(1, &image_texture);
+        return true;
+    }
 
 
 }
\ No newline at end of file
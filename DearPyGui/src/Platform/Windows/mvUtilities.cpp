@@ -19,25 +19,16 @@ namespace fs = std::filesystem;
 namespace Marvel {
 
 
-    // Simple helper function to load an image into a DX11 texture with common settings
-    bool LoadTextureFromFile(const char* filename, mvTexture& storage)
+    bool LoadTextureFromArray(const std::string& filename, const unsigned char* data, int width, int height, mvTexture& storage)
     {
 
-        //auto out_srv = static_cast<ID3D11ShaderResourceView**>(storage.texture);
         ID3D11ShaderResourceView* out_srv = nullptr;
 
-        // Load from disk into a raw RGBA buffer
-        int image_width = 0;
-        int image_height = 0;
-        unsigned char* image_data = stbi_load(filename, &image_width, &image_height, NULL, 4);
-        if (image_data == NULL)
-            return false;
-
         // Create texture
         D3D11_TEXTURE2D_DESC desc;
         ZeroMemory(&desc, sizeof(desc));
-        desc.Width = image_width;
-        desc.Height = image_height;
+        desc.Width = width;
+        desc.Height = height;
         desc.MipLevels = 1;
         desc.ArraySize = 1;
         desc.Format = DXGI_FORMAT_R8G8B8A8_UNORM;
@@ -48,10 +39,11 @@ namespace Marvel {
 
         ID3D11Texture2D* pTexture = NULL;
         D3D11_SUBRESOURCE_DATA subResource;
-        subResource.pSysMem = image_data;
+        subResource.pSysMem = data;
         subResource.SysMemPitch = desc.Width * 4;
         subResource.SysMemSlicePitch = 0;
-        mvWindowsWindow::getDevice()->CreateTexture2D(&desc, &subResource, &pTexture);
+        if (mvWindowsWindow::getDevice()->CreateTexture2D(&desc, &subResource, &pTexture) != S_OK)
+            return false;
 
         // Create texture view
         D3D11_SHADER_RESOURCE_VIEW_DESC srvDesc;
@@ -64,17 +56,17 @@ namespace Marvel {
         pTexture->Release();
 
         storage.texture = out_srv;
-        storage.width = image_width;
-        storage.height = image_height;
-        stbi_image_free(image_data);
+        storage.width = width;
+        storage.height = height;
 
         return true;
     }
 
-    bool UnloadTexture(const std::string& filename)
-	{
-		// TODO : decide if cleanup is necessary
-		return true;
-	}
+    bool UnloadTexture(const std::string& filename, const mvTexture& storage)
+    {
+        if (storage.texture)
+            ((ID3D11ShaderResourceView*)storage.texture)->Release();
+        return true;
+    }
 
 }
\ No newline at end of file
@@ -1,5 +1,6 @@
 #include "Platform/Windows/mvWindowsWindow.h"
 #include "mvApp.h"
+#include "Core/mvProfiler.h"
 
 // Forward declare message handler from imgui_impl_win32.cpp
 extern IMGUI_IMPL_API LRESULT ImGui_ImplWin32_WndProcHandler(HWND hWnd, UINT msg, WPARAM wParam, LPARAM lParam);
@@ -47,6 +48,11 @@ namespace Marvel {
 		SetWindowTextA(m_hwnd, name.c_str());
 	}
 
+	void mvWindowsWindow::wakeup()
+	{
+		::PostMessage(m_hwnd, WM_NULL, 0, 0);
+	}
+
 	void mvWindowsWindow::show()
 	{
 
@@ -89,11 +95,21 @@ namespace Marvel {
 		// - When io.WantCaptureMouse is true, do not dispatch mouse input data to your main application.
 		// - When io.WantCaptureKeyboard is true, do not dispatch keyboard input data to your main application.
 		// Generally you may always pass all inputs to dear imgui, and hide them from your application based on those two flags.
-		if (::PeekMessage(&m_msg, nullptr, 0U, 0U, PM_REMOVE))
+		double wait = mvApp::GetApp()->getEventWait();
+		if (wait > 0.0)
+		{
+			// input already in the queue (seen but not removed) also wakes the wait
+			DWORD result = ::MsgWaitForMultipleObjectsEx(0, nullptr, (DWORD)(wait * 1000.0), QS_ALLINPUT, MWMO_INPUTAVAILABLE);
+			mvApp::GetApp()->endEventWait(result != WAIT_TIMEOUT);
+		}
+
+		// handle everything queued, otherwise input waits for the next frame
+		while (::PeekMessage(&m_msg, nullptr, 0U, 0U, PM_REMOVE))
 		{
 			::TranslateMessage(&m_msg);
 			::DispatchMessage(&m_msg);
-			//continue;
+			if (m_msg.message == WM_QUIT)
+				m_running = false;
 		}
 
 		// Start the Dear ImGui frame
@@ -105,6 +121,7 @@ namespace Marvel {
 	void mvWindowsWindow::renderFrame()
 	{
 		prerender();
+		mvProfiler::BeginFrame();
 
 		if (m_error)
 		{
@@ -133,7 +150,12 @@ namespace Marvel {
 			m_app->postrender();
 		}
 
-		postrender();
+		{
+			MV_PROFILE_SCOPE("present");
+			postrender();
+		}
+
+		mvProfiler::EndFrame();
 	}
 
 	void mvWindowsWindow::run()
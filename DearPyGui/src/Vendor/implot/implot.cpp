@@ -1886,6 +1886,11 @@ namespace ImPlot {
         return gp.BB_Plot.GetSize();
     }
 
+    bool IsPlotFitting() {
+        IM_ASSERT_USER_ERROR(gp.CurrentPlot != NULL, "IsPlotFitting() needs to be called between BeginPlot() and EndPlot()!");
+        return gp.FitThisFrame;
+    }
+
     void PushPlotClipRect() {
         IM_ASSERT_USER_ERROR(gp.CurrentPlot != NULL, "PushPlotClipRect() needs to be called between BeginPlot() and EndPlot()!");
         ImGui::PushClipRect(gp.BB_Plot.Min, gp.BB_Plot.Max, true);
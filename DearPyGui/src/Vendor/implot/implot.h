@@ -386,6 +386,8 @@ namespace ImPlot {
     ImVec2 GetPlotPos();
     // Get the curent Plot size in pixels.
     ImVec2 GetPlotSize();
+    // Returns true if the current plot is being auto-fit this frame (items should submit all of their data).
+    bool IsPlotFitting();
 
     // Convert pixels to a position in the current plot's coordinate system. A negative y_axis uses the current value of SetPlotYAxis (0 initially).
     ImPlotPoint PixelsToPlot(const ImVec2& pix, int y_axis = -1);
@@ -1,4 +1,4 @@
-from typing import List, Any
+from typing import List, Any, Callable, Union
 
 def add_additional_font(file: str, size: float = 13.0, glyph_ranges: str = "") -> None:
 	"""Adds additional font. Glyph_ranges options: korean, japanese, chinese_full, chinese_simplified_common, cryillic, thai, vietnamese"""
@@ -8,11 +8,11 @@ def add_area_series(plot: str, name: str, data: List[float], color: List[float],
 	"""Adds a area series to a plot."""
 	...
 
-def add_button(name: str, small: bool = False, arrow: bool = False, direction: int = -1, callback: str = "", tip: str = "", parent: str = "", before: str = "", width: int = 0, height: int = 0) -> None:
+def add_button(name: str, small: bool = False, arrow: bool = False, direction: int = -1, callback: Union[str, Callable] = "", tip: str = "", parent: str = "", before: str = "", width: int = 0, height: int = 0) -> None:
 	"""Adds a button."""
 	...
 
-def add_checkbox(name: str, default_value: int = 0, callback: str = "", tip: str = "", parent: str = "", before: str = "", data_source: str = "") -> None:
+def add_checkbox(name: str, default_value: int = 0, callback: Union[str, Callable] = "", tip: str = "", parent: str = "", before: str = "", data_source: str = "") -> None:
 	"""Adds a checkbox widget."""
 	...
 
@@ -24,19 +24,19 @@ def add_collapsing_header(name: str, default_open: bool = False, closable: bool
 	"""Adds a collapsing header to add items to. Must be closed with the end_collapsing_header command."""
 	...
 
-def add_color_edit3(name: str, default_value: List[int] = [0, 0, 0], callback: str = "", tip: str = "", parent: str = "", before: str = "", data_source: str = "", width: int = 0, height: int = 0) -> None:
+def add_color_edit3(name: str, default_value: List[int] = [0, 0, 0], callback: Union[str, Callable] = "", tip: str = "", parent: str = "", before: str = "", data_source: str = "", width: int = 0, height: int = 0) -> None:
 	"""Adds an rgb color editing widget."""
 	...
 
-def add_color_edit4(name: str, default_value: List[int] = [0,0,0,0], callback: str = "", tip: str = "", parent: str = "", before: str = "", data_source: str = "", width: int = 0, height: int = 0) -> None:
+def add_color_edit4(name: str, default_value: List[int] = [0,0,0,0], callback: Union[str, Callable] = "", tip: str = "", parent: str = "", before: str = "", data_source: str = "", width: int = 0, height: int = 0) -> None:
 	"""Adds an rgba color editing widget."""
 	...
 
-def add_color_picker3(name: str, default_value: List[int] = [0, 0, 0], callback: str = "", tip: str = "", parent: str = "", before: str = "", data_source: str = "", width: int = 0, height: int = 0) -> None:
+def add_color_picker3(name: str, default_value: List[int] = [0, 0, 0], callback: Union[str, Callable] = "", tip: str = "", parent: str = "", before: str = "", data_source: str = "", width: int = 0, height: int = 0) -> None:
 	"""Adds an rgb color picking widget."""
 	...
 
-def add_color_picker4(name: str, default_value: List[int] = [0, 0, 0, 0], callback: str = "", tip: str = "", parent: str = "", before: str = "", data_source: str = "", width: int = 0, height: int = 0) -> None:
+def add_color_picker4(name: str, default_value: List[int] = [0, 0, 0, 0], callback: Union[str, Callable] = "", tip: str = "", parent: str = "", before: str = "", data_source: str = "", width: int = 0, height: int = 0) -> None:
 	"""Adds an rgba color picking widget."""
 	...
 
@@ -44,7 +44,7 @@ def add_column(table: str, name: str, column: List[str]) -> None:
 	"""Adds a column to the end of a table."""
 	...
 
-def add_combo(name: str, items: List[str], default_value: str = "", callback: str = "", tip: str = "", parent: str = "", before: str = "", data_source: str = "", width: int = 0, secondary_data_source: str = "") -> None:
+def add_combo(name: str, items: List[str], default_value: str = "", callback: Union[str, Callable] = "", tip: str = "", parent: str = "", before: str = "", data_source: str = "", width: int = 0, secondary_data_source: str = "") -> None:
 	"""Adds a combo."""
 	...
 
@@ -52,35 +52,35 @@ def add_data(name: str, data: object) -> None:
 	"""Adds data for later retrieval."""
 	...
 
-def add_drag_float(name: str, default_value: float = 0.0, speed: float = 1.0, min_value: float = 0.0, max_value: float = 100.0, format: str = "%.3f", power: float = 1.0, callback: str = "", tip: str = "", parent: str = "", before: str = "", data_source: str = "", width: int = 0) -> None:
+def add_drag_float(name: str, default_value: float = 0.0, speed: float = 1.0, min_value: float = 0.0, max_value: float = 100.0, format: str = "%.3f", power: float = 1.0, callback: Union[str, Callable] = "", tip: str = "", parent: str = "", before: str = "", data_source: str = "", width: int = 0) -> None:
 	"""Adds drag for a single float value"""
 	...
 
-def add_drag_float2(name: str, default_value: List[float] = [0.0,0.0], speed: float = 1.0, min_value: float = 0.0, max_value: float = 100.0, format: str = "%.3f", callback: str = "", tip: str = "", parent: str = "", before: str = "", data_source: str = "", width: int = 0) -> None:
+def add_drag_float2(name: str, default_value: List[float] = [0.0,0.0], speed: float = 1.0, min_value: float = 0.0, max_value: float = 100.0, format: str = "%.3f", callback: Union[str, Callable] = "", tip: str = "", parent: str = "", before: str = "", data_source: str = "", width: int = 0) -> None:
 	"""Adds drag for a 2 float values."""
 	...
 
-def add_drag_float3(name: str, default_value: List[float] = [0.0, 0.0, 0.0], speed: float = 1.0, min_value: float = 0.0, max_value: float = 100.0, format: str = "%.3f", callback: str = "", tip: str = "", parent: str = "", before: str = "", data_source: str = "", width: int = 0) -> None:
+def add_drag_float3(name: str, default_value: List[float] = [0.0, 0.0, 0.0], speed: float = 1.0, min_value: float = 0.0, max_value: float = 100.0, format: str = "%.3f", callback: Union[str, Callable] = "", tip: str = "", parent: str = "", before: str = "", data_source: str = "", width: int = 0) -> None:
 	"""Adds drag for a 3 float values."""
 	...
 
-def add_drag_float4(name: str, default_value: List[float] = [0.0, 0.0, 0.0, 0.0], speed: float = 1.0, min_value: float = 0.0, max_value: float = 100.0, format: str = "%.3f", callback: str = "", tip: str = "", parent: str = "", before: str = "", data_source: str = "", width: int = 0) -> None:
+def add_drag_float4(name: str, default_value: List[float] = [0.0, 0.0, 0.0, 0.0], speed: float = 1.0, min_value: float = 0.0, max_value: float = 100.0, format: str = "%.3f", callback: Union[str, Callable] = "", tip: str = "", parent: str = "", before: str = "", data_source: str = "", width: int = 0) -> None:
 	"""Adds drag for a 4 float values."""
 	...
 
-def add_drag_int(name: str, default_value: int = 0, speed: float = 1.0, min_value: int = 0, max_value: int = 100, format: str = "%d", callback: str = "", tip: str = "", parent: str = "", before: str = "", data_source: str = "", width: int = 0) -> None:
+def add_drag_int(name: str, default_value: int = 0, speed: float = 1.0, min_value: int = 0, max_value: int = 100, format: str = "%d", callback: Union[str, Callable] = "", tip: str = "", parent: str = "", before: str = "", data_source: str = "", width: int = 0) -> None:
 	"""Adds drag for a single int value"""
 	...
 
-def add_drag_int2(name: str, default_value: List[int] = [0, 0], speed: float = 1.0, min_value: int = 0, max_value: int = 100, format: str = "%d", callback: str = "", tip: str = "", parent: str = "", before: str = "", data_source: str = "", width: int = 0) -> None:
+def add_drag_int2(name: str, default_value: List[int] = [0, 0], speed: float = 1.0, min_value: int = 0, max_value: int = 100, format: str = "%d", callback: Union[str, Callable] = "", tip: str = "", parent: str = "", before: str = "", data_source: str = "", width: int = 0) -> None:
 	"""Adds drag for a 2 int values."""
 	...
 
-def add_drag_int3(name: str, default_value: List[int] = [0, 0, 0], speed: float = 1.0, min_value: int = 0, max_value: int = 100, format: str = "%d", callback: str = "", tip: str = "", parent: str = "", before: str = "", data_source: str = "", width: int = 0) -> None:
+def add_drag_int3(name: str, default_value: List[int] = [0, 0, 0], speed: float = 1.0, min_value: int = 0, max_value: int = 100, format: str = "%d", callback: Union[str, Callable] = "", tip: str = "", parent: str = "", before: str = "", data_source: str = "", width: int = 0) -> None:
 	"""Adds drag for a 3 int values."""
 	...
 
-def add_drag_int4(name: str, default_value: List[int] = [0, 0, 0, 0], speed: float = 1.0, min_value: int = 0, max_value: int = 100, format: str = "%d", callback: str = "", tip: str = "", parent: str = "", before: str = "", data_source: str = "", width: int = 0) -> None:
+def add_drag_int4(name: str, default_value: List[int] = [0, 0, 0, 0], speed: float = 1.0, min_value: int = 0, max_value: int = 100, format: str = "%d", callback: Union[str, Callable] = "", tip: str = "", parent: str = "", before: str = "", data_source: str = "", width: int = 0) -> None:
 	"""Adds drag for a 4 int values."""
 	...
 
@@ -101,40 +101,40 @@ def add_indent(name: str = "", offset: float = 0.0, parent: str = "", before: st
 	"""Adds an indent to following items. Must be closed with the unindent command."""
 	...
 
-def add_input_float(name: str, default_value: float = 0.0, format: str = "%.3f", callback: str = "", tip: str = "", parent: str = "", before: str = "", data_source: str = "", width: int = 0) -> None:
+def add_input_float(name: str, default_value: float = 0.0, format: str = "%.3f", callback: Union[str, Callable] = "", tip: str = "", parent: str = "", before: str = "", data_source: str = "", width: int = 0) -> None:
 	"""Adds input for float values."""
 	...
 
-def add_input_float2(name: str, default_value: List[float] = [0.0, 0.0], format: str = "%.3f", callback: str = "", tip: str = "", parent: str = "", before: str = "", data_source: str = "", width: int = 0) -> None:
+def add_input_float2(name: str, default_value: List[float] = [0.0, 0.0], format: str = "%.3f", callback: Union[str, Callable] = "", tip: str = "", parent: str = "", before: str = "", data_source: str = "", width: int = 0) -> None:
 	"""Adds input for 2 float values."""
 	...
 
-def add_input_float3(name: str, default_value: List[float] = [0.0, 0.0, 0.0], format: str = "%.3f", callback: str = "", tip: str = "", parent: str = "", before: str = "", data_source: str = "", width: int = 0) -> None:
+def add_input_float3(name: str, default_value: List[float] = [0.0, 0.0, 0.0], format: str = "%.3f", callback: Union[str, Callable] = "", tip: str = "", parent: str = "", before: str = "", data_source: str = "", width: int = 0) -> None:
 	"""Adds input for 3 float values."""
 	...
 
-def add_input_float4(name: str, default_value: List[float] = [0.0, 0.0, 0.0, 0.0], format: str = "%.3f", callback: str = "", tip: str = "", parent: str = "", before: str = "", data_source: str = "", width: int = 0) -> None:
+def add_input_float4(name: str, default_value: List[float] = [0.0, 0.0, 0.0, 0.0], format: str = "%.3f", callback: Union[str, Callable] = "", tip: str = "", parent: str = "", before: str = "", data_source: str = "", width: int = 0) -> None:
 	"""Adds input for 4 float values."""
 	...
 
-def add_input_int(name: str, default_value: int = 0, callback: str = "", tip: str = "", parent: str = "", before: str = "", data_source: str = "", width: int = 0) -> None:
+def add_input_int(name: str, default_value: int = 0, callback: Union[str, Callable] = "", tip: str = "", parent: str = "", before: str = "", data_source: str = "", width: int = 0) -> None:
 	"""Adds input for integer values."""
 	...
 
-def add_input_int2(name: str, default_value: List[int] = [0, 0], callback: str = "", tip: str = "", parent: str = "", before: str = "", data_source: str = "", width: int = 0) -> None:
+def add_input_int2(name: str, default_value: List[int] = [0, 0], callback: Union[str, Callable] = "", tip: str = "", parent: str = "", before: str = "", data_source: str = "", width: int = 0) -> None:
 	"""Adds input for 2 integer values."""
 	...
 
-def add_input_int3(name: str, default_value: List[int] = [0, 0, 0], callback: str = "", tip: str = "", parent: str = "", before: str = "", data_source: str = "", width: int = 0) -> None:
+def add_input_int3(name: str, default_value: List[int] = [0, 0, 0], callback: Union[str, Callable] = "", tip: str = "", parent: str = "", before: str = "", data_source: str = "", width: int = 0) -> None:
 	"""Adds input for 3 integer values."""
 	...
 
-def add_input_int4(name: str, default_value: List[int] = [0, 0, 0, 0], callback: str = "", tip: str = "", parent: str = "", before: str = "", data_source: str = "", width: int = 0) -> None:
+def add_input_int4(name: str, default_value: List[int] = [0, 0, 0, 0], callback: Union[str, Callable] = "", tip: str = "", parent: str = "", before: str = "", data_source: str = "", width: int = 0) -> None:
 	"""Adds input for 4 integer values."""
 	...
 
 def add_input_text(name: str, default_value: str = "", hint: str = "", multiline: bool = False, no_spaces: bool = False, uppercase: bool = False, decimal: bool = False, hexadecimal: bool = False, 
-				   readonly: bool = False, password: bool = False, callback: str = "", tip: str = "", parent: str = "", before: str = "", data_source: str = "", width: int = 0) -> None:
+				   readonly: bool = False, password: bool = False, callback: Union[str, Callable] = "", tip: str = "", parent: str = "", before: str = "", data_source: str = "", width: int = 0) -> None:
 	"""Adds input for text values."""
 	...
 
@@ -146,11 +146,11 @@ def add_label_text(name: str, value: str, color: List[float] = [0.0, 0.0, 0.0, 2
 	"""Adds text with a label. Useful for output values."""
 	...
 
-def add_line_series(plot: str, name: str, data: List[float], color: List[float] = ..., fill: List[float] = ..., weight: float = 1.0) -> None:
+def add_line_series(plot: str, name: str, data: List[float] = ..., color: List[float] = ..., fill: List[float] = ..., weight: float = 1.0, x: object = ..., y: object = ..., capacity: int = 0) -> None:
 	"""Adds a line series to a plot."""
 	...
 
-def add_listbox(name: str, items: List[str], default_value: int = 0, callback: str = "", tip: str = "", parent: str = "", before: str = "", data_source: str = "", width: int = 0, height: int = 0, secondary_data_source: str = "") -> None:
+def add_listbox(name: str, items: List[str], default_value: int = 0, callback: Union[str, Callable] = "", tip: str = "", parent: str = "", before: str = "", data_source: str = "", width: int = 0, height: int = 0, secondary_data_source: str = "") -> None:
 	"""Adds a listbox."""
 	...
 
@@ -162,11 +162,11 @@ def add_menu_bar(name: str, parent: str = "", before: str = "") -> None:
 	"""Adds a menu bar to a window. Must be followed by a call to end_menu_bar."""
 	...
 
-def add_menu_item(name: str, callback: str = "", tip: str = "", parent: str = "", before: str = "") -> None:
+def add_menu_item(name: str, callback: Union[str, Callable] = "", tip: str = "", parent: str = "", before: str = "") -> None:
 	"""Adds a menu item to an existing menu."""
 	...
 
-def add_plot(name: str, xAxisName: str = "", yAxisName: str = "", flags: int = 0, xflags: int = 0, yflags: int = 0, parent: str = "", before: str = "", width: int = -1, height: int = -1, query_callback: str = "") -> None:
+def add_plot(name: str, xAxisName: str = "", yAxisName: str = "", flags: int = 0, xflags: int = 0, yflags: int = 0, parent: str = "", before: str = "", width: int = -1, height: int = -1, query_callback: Union[str, Callable] = "") -> None:
 	"""Adds a plot widget."""
 	...
 
@@ -178,7 +178,7 @@ def add_progress_bar(name: str, value: float = 0.0, overlay: str = "", tip: str
 	"""Adds a progress bar."""
 	...
 
-def add_radio_button(name: str, items: List[str], default_value: int = 0, callback: str = "", tip: str = "", parent: str = "", before: str = "", data_source: str = "", secondary_data_source: str = "") -> None:
+def add_radio_button(name: str, items: List[str], default_value: int = 0, callback: Union[str, Callable] = "", tip: str = "", parent: str = "", before: str = "", data_source: str = "", secondary_data_source: str = "") -> None:
 	"""Adds a set of radio buttons."""
 	...
 
@@ -194,11 +194,11 @@ def add_same_line(name: str = "", xoffset: float = 0.0, spacing: float = -1.0, p
 	"""Places a widget on the same line as the previous widget. Can also be used for horizontal spacing."""
 	...
 
-def add_scatter_series(plot: str, name: str, data: List[float], marker: int = 2, size: float = 4.0, weight: float = 1.0, outline: List[float] = ..., fill: List[float] = ...) -> None:
+def add_scatter_series(plot: str, name: str, data: List[float] = ..., marker: int = 2, size: float = 4.0, weight: float = 1.0, outline: List[float] = ..., fill: List[float] = ..., x: object = ..., y: object = ..., capacity: int = 0) -> None:
 	"""Adds a scatter series to a plot."""
 	...
 
-def add_selectable(name: str, default_value: bool = False, callback: str = "", tip: str = "", parent: str = "", before: str = "", data_source: str = "") -> None:
+def add_selectable(name: str, default_value: bool = False, callback: Union[str, Callable] = "", tip: str = "", parent: str = "", before: str = "", data_source: str = "") -> None:
 	"""Adds a selectable."""
 	...
 
@@ -210,35 +210,35 @@ def add_simple_plot(name: str, value: List[float], autoscale: bool = True, overl
 	"""A simple plot for visualization of a set of values"""
 	...
 
-def add_slider_float(name: str, default_value: float = 0.0, min_value: float = 0.0, max_value: float = 100.0, format: str = "%.3f", vertical: bool = False, callback: str = "", tip: str = "", parent: str = "", before: str = "", data_source: str = "", width: int = 0, height: int = 0) -> None:
+def add_slider_float(name: str, default_value: float = 0.0, min_value: float = 0.0, max_value: float = 100.0, format: str = "%.3f", vertical: bool = False, callback: Union[str, Callable] = "", tip: str = "", parent: str = "", before: str = "", data_source: str = "", width: int = 0, height: int = 0) -> None:
 	"""Adds slider for a single float value"""
 	...
 
-def add_slider_float2(name: str, default_value: List[float] = [0.0, 0.0], min_value: float = 0.0, max_value: float = 100.0, format: str = "%.3f", callback: str = "", tip: str = "", parent: str = "", before: str = "", data_source: str = "", width: int = 0) -> None:
+def add_slider_float2(name: str, default_value: List[float] = [0.0, 0.0], min_value: float = 0.0, max_value: float = 100.0, format: str = "%.3f", callback: Union[str, Callable] = "", tip: str = "", parent: str = "", before: str = "", data_source: str = "", width: int = 0) -> None:
 	"""Adds slider for a 2 float values."""
 	...
 
-def add_slider_float3(name: str, default_value: List[float] = [0.0, 0.0, 0.0], min_value: float = 0.0, max_value: float = 100.0, format: str = "%.3f", callback: str = "", tip: str = "", parent: str = "", before: str = "", data_source: str = "", width: int = 0) -> None:
+def add_slider_float3(name: str, default_value: List[float] = [0.0, 0.0, 0.0], min_value: float = 0.0, max_value: float = 100.0, format: str = "%.3f", callback: Union[str, Callable] = "", tip: str = "", parent: str = "", before: str = "", data_source: str = "", width: int = 0) -> None:
 	"""Adds slider for a 3 float values."""
 	...
 
-def add_slider_float4(name: str, default_value: List[float] = [0.0, 0.0, 0.0, 0.0], min_value: float = 0.0, max_value: float = 100.0, format: str = "%.3f", callback: str = "", tip: str = "", parent: str = "", before: str = "", data_source: str = "", width: int = 0) -> None:
+def add_slider_float4(name: str, default_value: List[float] = [0.0, 0.0, 0.0, 0.0], min_value: float = 0.0, max_value: float = 100.0, format: str = "%.3f", callback: Union[str, Callable] = "", tip: str = "", parent: str = "", before: str = "", data_source: str = "", width: int = 0) -> None:
 	"""Adds slider for a 4 float values."""
 	...
 
-def add_slider_int(name: str, default_value: int = 0, min_value: int = 0, max_value: int = 100, format: str = "%d", vertical: bool = False, callback: str = "", tip: str = "", parent: str = "", before: str = "", data_source: str = "", width: int = 0, height: int = 0) -> None:
+def add_slider_int(name: str, default_value: int = 0, min_value: int = 0, max_value: int = 100, format: str = "%d", vertical: bool = False, callback: Union[str, Callable] = "", tip: str = "", parent: str = "", before: str = "", data_source: str = "", width: int = 0, height: int = 0) -> None:
 	"""Adds slider for a single int value"""
 	...
 
-def add_slider_int2(name: str, default_value: List[int] = [0, 0], min_value: int = 0, max_value: int = 100, format: str = "%d", callback: str = "", tip: str = "", parent: str = "", before: str = "", data_source: str = "", width: int = 0) -> None:
+def add_slider_int2(name: str, default_value: List[int] = [0, 0], min_value: int = 0, max_value: int = 100, format: str = "%d", callback: Union[str, Callable] = "", tip: str = "", parent: str = "", before: str = "", data_source: str = "", width: int = 0) -> None:
 	"""Adds slider for a 2 int values."""
 	...
 
-def add_slider_int3(name: str, default_value: List[int] = [0, 0, 0], min_value: int = 0, max_value: int = 100, format: str = "%d", callback: str = "", tip: str = "", parent: str = "", before: str = "", data_source: str = "", width: int = 0) -> None:
+def add_slider_int3(name: str, default_value: List[int] = [0, 0, 0], min_value: int = 0, max_value: int = 100, format: str = "%d", callback: Union[str, Callable] = "", tip: str = "", parent: str = "", before: str = "", data_source: str = "", width: int = 0) -> None:
 	"""Adds slider for a 3 int values."""
 	...
 
-def add_slider_int4(name: str, default_value: List[int] = [0, 0, 0, 0], min_value: int = 0, max_value: int = 100, format: str = "%d", callback: str = "", tip: str = "", parent: str = "", before: str = "", data_source: str = "", width: int = 0) -> None:
+def add_slider_int4(name: str, default_value: List[int] = [0, 0, 0, 0], min_value: int = 0, max_value: int = 100, format: str = "%d", callback: Union[str, Callable] = "", tip: str = "", parent: str = "", before: str = "", data_source: str = "", width: int = 0) -> None:
 	"""Adds slider for a 4 int values."""
 	...
 
@@ -250,11 +250,11 @@ def add_tab(name: str, closable: bool = False, tip: str = "", parent: str = "",
 	"""Adds a tab to a tab bar. Must be closed with the end_tab command."""
 	...
 
-def add_tab_bar(name: str, reorderable: bool = False, callback: str = "", parent: str = "", before: str = "", data_source: str = "") -> None:
+def add_tab_bar(name: str, reorderable: bool = False, callback: Union[str, Callable] = "", parent: str = "", before: str = "", data_source: str = "") -> None:
 	"""Adds a tab bar."""
 	...
 
-def add_table(name: str, headers: List[str], callback: str = "", parent: str = "", before: str = "") -> None:
+def add_table(name: str, headers: List[str], callback: Union[str, Callable] = "", parent: str = "", before: str = "") -> None:
 	"""Adds table."""
 	...
 
@@ -279,6 +279,10 @@ def add_window(name: str, width: int = -1, height: int = -1, start_x: int = 200,
 	"""Creates a new window for following items to be added to. Must call end_main_window command before adding any new windows."""
 	...
 
+def append_series_data(plot: str, series: str, data: List[float] = ..., x: object = ..., y: object = ...) -> None:
+	"""Appends points to an existing line or scatter series."""
+	...
+
 def cleanup_dearpygui() -> None:
 	"""Cleans up DearPyGui after calling setup_dearpygui."""
 	...
@@ -311,6 +315,10 @@ def delete_data(name: str) -> None:
 	"""Deletes data from storage."""
 	...
 
+def delete_draw_command(drawing: str, tag: str) -> None:
+	"""Deletes the drawing command with the tag."""
+	...
+
 def delete_item(item: str, children_only: bool = False) -> None:
 	"""Deletes an item if it exists."""
 	...
@@ -331,6 +339,10 @@ def draw_circle(drawing: str, center: List[float], radius: float, color: List[in
 	"""Draws a circle on a drawing."""
 	...
 
+def draw_circles(drawing: str, centers: List[float], radii: List[float], colors: List[int], segments: int = 12, thickness: float = 1.0, fills: List[int] = ..., tag: str = "") -> None:
+	"""Draws many circles on a drawing as one command. Centers are packed x, y pairs, radii are one radius or one per circle and colors/fills are one RGBA color or one per circle (packed). Lists or buffers (i.e. numpy arrays) are accepted."""
+	...
+
 def draw_image(drawing: str, file: str, pmin: List[float], pmax: List[float] = [-100.0, -100.0], uv_min: List[float] = [0.0, 0.0], uv_max: List[float] = [1.0, 1.0], color: List[int] = ..., tag: str = "") -> None:
 	"""Draws an image on a drawing. p_min and p_max represent the upper-left and lower-right corners of the rectangle. 
 		uv_min and uv_max represent the normalized texture coordinates to use for those corners. Using (0,0)->(1,1) texture 
@@ -341,6 +353,10 @@ def draw_line(drawing: str, p1: List[float], p2: List[float], color: List[int],
 	"""Draws a line on a drawing."""
 	...
 
+def draw_lines(drawing: str, points: List[float], colors: List[int], thickness: float = 1.0, tag: str = "") -> None:
+	"""Draws many lines on a drawing as one command. Points are packed x1, y1, x2, y2 per line and colors are one RGBA color or one per line (packed). Lists or buffers (i.e. numpy arrays) are accepted."""
+	...
+
 def draw_polygon(drawing: str, points: List[List[float]], color: List[int], fill: List[float] = ..., thickness: float = 1.0, tag: str = "") -> None:
 	"""Draws a polygon on a drawing."""
 	...
@@ -357,6 +373,10 @@ def draw_rectangle(drawing: str, pmin: List[float], pmax: List[float], color: Li
 	"""Draws a rectangle on a drawing."""
 	...
 
+def draw_rectangles(drawing: str, points: List[float], colors: List[int], fills: List[int] = ..., rounding: float = 0.0, thickness: float = 1.0, tag: str = "") -> None:
+	"""Draws many rectangles on a drawing as one command. Points are packed xmin, ymin, xmax, ymax per rectangle and colors/fills are one RGBA color or one per rectangle (packed). Lists or buffers (i.e. numpy arrays) are accepted."""
+	...
+
 def draw_text(drawing: str, pos: List[float], text: str, color: List[int] = ..., size: int = 10, tag: str = "") -> None:
 	"""Draws text on a drawing."""
 	...
@@ -409,6 +429,10 @@ def end_window() -> None:
 	"""Ends the window created by a call to add_window."""
 	...
 
+def export_profile_trace(file: str) -> None:
+	"""Writes the recorded frames to a file in the Chrome trace format (chrome://tracing)."""
+	...
+
 def get_active_window() -> str:
 	"""Returns the active window name."""
 	...
@@ -493,6 +517,10 @@ def get_plot_query_area(plot: str) -> List[float]:
 	"""Returns the bounding axis limits for the query area [x_min, x_max, y_min, y_max]"""
 	...
 
+def get_profile_zones() -> List[List[Any]]:
+	"""Returns the timing zones of the last recorded frame as [name, start (ms), duration (ms), depth]."""
+	...
+
 def get_style_antialiased_fill() -> bool:
 	"""Gets anti-aliasing on filled shapes (rounded rectangles, circles, etc.)."""
 	...
@@ -625,6 +653,10 @@ def get_table_selections(table: str) -> List[List[int]]:
 	"""Retrieves data from storage."""
 	...
 
+def get_texture_upload_budget() -> int:
+	"""Returns how many bytes of decoded images are uploaded to the GPU each frame."""
+	...
+
 def get_theme() -> str:
 	"""Returns the current theme."""
 	...
@@ -745,6 +777,14 @@ def is_plot_queried(plot: str) -> bool:
 	"""Returns true if plot was queried"""
 	...
 
+def is_power_saving_mode() -> bool:
+	"""Checks if power saving mode is enabled."""
+	...
+
+def is_profiling() -> bool:
+	"""Checks if timing zones are being recorded."""
+	...
+
 def is_threadpool_high_performance() -> bool:
 	"""Checks if the threadpool is allowed to use the maximum number of threads."""
 	...
@@ -777,7 +817,7 @@ def move_item_up(item: str) -> None:
 	"""Moves item up if possible and if it exists."""
 	...
 
-def open_file_dialog(callback: str = "", extensions: str = ".*") -> str:
+def open_file_dialog(callback: Union[str, Callable] = "", extensions: str = ".*") -> str:
 	"""Opens an 'open file' dialog."""
 	...
 
@@ -785,6 +825,10 @@ def render_dearpygui_frame() -> None:
 	"""Renders a DearPyGui frame. Should be called within a user's event loop. Must first call setup_dearpygui outside of event loop."""
 	...
 
+def request_redraw() -> None:
+	"""Renders a frame when in power saving mode. Can be called from any thread."""
+	...
+
 def reset_xticks(plot: str) -> None:
 	"""Sets plots x ticks and labels back to automatic"""
 	...
@@ -793,11 +837,11 @@ def reset_yticks(plot: str) -> None:
 	"""Sets plots y ticks and labels back to automatic"""
 	...
 
-def run_async_function(name: str, data: object, return_handler: str = "") -> None:
+def run_async_function(name: str, data: object, return_handler: Union[str, Callable] = "") -> None:
 	"""Runs a function asyncronously."""
 	...
 
-def select_directory_dialog(callback: str = "") -> None:
+def select_directory_dialog(callback: Union[str, Callable] = "") -> None:
 	"""Opens a select directory dialog."""
 	...
 
@@ -821,7 +865,11 @@ def set_global_font_scale(scale: float) -> None:
 	"""Changes the global font scale."""
 	...
 
-def set_item_callback(item: str, callback: str) -> None:
+def set_input_callback(callback: Union[str, Callable], handler: str = "") -> None:
+	"""Sets a callback receiving all key and mouse events of a frame in a single call. The data is a dict with keys_pressed, keys_down, keys_released, mouse_clicked, mouse_double_clicked, mouse_down, mouse_released and mouse_wheel. Down events are (index, duration) pairs. Only called on frames with input."""
+	...
+
+def set_item_callback(item: str, callback: Union[str, Callable]) -> None:
 	"""Sets an item's callback if applicable."""
 	...
 
@@ -841,15 +889,15 @@ def set_item_width(item: str, width: int) -> None:
 	"""Sets an item's width."""
 	...
 
-def set_key_down_callback(callback: str, handler: str = "") -> None:
+def set_key_down_callback(callback: Union[str, Callable], handler: str = "") -> None:
 	"""Sets a callback for a key down event."""
 	...
 
-def set_key_press_callback(callback: str, handler: str = "") -> None:
+def set_key_press_callback(callback: Union[str, Callable], handler: str = "") -> None:
 	"""Sets a callback for a key press event."""
 	...
 
-def set_key_release_callback(callback: str, handler: str = "") -> None:
+def set_key_release_callback(callback: Union[str, Callable], handler: str = "") -> None:
 	"""Sets a callback for a key release event."""
 	...
 
@@ -865,23 +913,23 @@ def set_main_window_title(title: str) -> None:
 	"""Sets the main window title."""
 	...
 
-def set_mouse_click_callback(callback: str, handler: str = "") -> None:
+def set_mouse_click_callback(callback: Union[str, Callable], handler: str = "") -> None:
 	"""Sets a callback for a mouse click event."""
 	...
 
-def set_mouse_double_click_callback(callback: str, handler: str = "") -> None:
+def set_mouse_double_click_callback(callback: Union[str, Callable], handler: str = "") -> None:
 	"""Sets a callback for a mouse double click event."""
 	...
 
-def set_mouse_down_callback(callback: str, handler: str = "") -> None:
+def set_mouse_down_callback(callback: Union[str, Callable], handler: str = "") -> None:
 	"""Sets a callback for a mouse down event."""
 	...
 
-def set_mouse_drag_callback(callback: str, threshold: float, handler: str = "") -> None:
+def set_mouse_drag_callback(callback: Union[str, Callable], threshold: float, handler: str = "") -> None:
 	"""Sets a callback for a mouse drag event."""
 	...
 
-def set_mouse_wheel_callback(callback: str, handler: str = "") -> None:
+def set_mouse_wheel_callback(callback: Union[str, Callable], handler: str = "") -> None:
 	"""Sets a callback for a mouse wheel event."""
 	...
 
@@ -901,11 +949,19 @@ def set_plot_ylimits_auto(plot: str) -> None:
 	"""Sets plots y limits to be automatic."""
 	...
 
-def set_render_callback(callback: str, handler: str = "") -> None:
+def set_power_saving_mode(value: bool) -> None:
+	"""When enabled, frames (and render callbacks) only run on input, async returns, queued updates or request_redraw. Otherwise the render loop sleeps."""
+	...
+
+def set_profiling(value: bool) -> None:
+	"""Starts or stops recording timing zones for each frame. Recorded frames are shown in the metrics window."""
+	...
+
+def set_render_callback(callback: Union[str, Callable], handler: str = "") -> None:
 	"""Sets the callback to be ran every frame."""
 	...
 
-def set_resize_callback(callback: str, handler: str = "") -> None:
+def set_resize_callback(callback: Union[str, Callable], handler: str = "") -> None:
 	"""Sets a callback for a window resize event"""
 	...
 
@@ -1033,14 +1089,30 @@ def set_style_window_title_align(x: float, y: float) -> None:
 	"""Sets alignment for title bar text. Defaults to (0.0,0.5) for left-aligned,vertically centered."""
 	...
 
+def set_table_data(table: str, columns: object, headers: List[str] = [], formats: List[str] = []) -> None:
+	"""Replaces a table's data with columns."""
+	...
+
 def set_table_item(table: str, row: int, column: int, value: str) -> None:
 	"""Sets a table's cell value."""
 	...
 
+def set_table_rows(table: str, start: int, rows: object) -> None:
+	"""Replaces rows of a table starting at start, extending the table if needed."""
+	...
+
 def set_table_selection(table: str, row: int, column: int, value: bool) -> None:
 	"""Sets a table's cell selection value."""
 	...
 
+def set_texture_memory_budget(bytes: int) -> None:
+	"""Sets how much GPU memory textures may use before unused textures are released, least recently used first."""
+	...
+
+def set_texture_upload_budget(bytes: int) -> None:
+	"""Sets how many bytes of decoded images are uploaded to the GPU each frame. At least one image is uploaded per frame."""
+	...
+
 def set_theme(theme: str) -> None:
 	"""Set the application's theme to a built-in theme."""
 	...
@@ -10,7 +10,10 @@ add_text("If you click 'Start Long Process', you should see the frame rate freez
 add_text("The solution is to run the long process asyncronously on a separate thread.", bullet=True)
 add_text("If you click 'Start Long Asyncronous Process', you should see the frame rate should not be affected.", bullet=True)
 add_text("To run an asyncronous function, use 'run_async_function'.", bullet=True)
-add_text("Currently, dearpygui functions can't be ran inside the asyncronous function.", bullet=True)
+add_text("Most dearpygui functions can't be ran inside the asyncronous function, but set_value, add_data,"
+         " delete_item and add_* widget commands can. They are applied at the start of the next frame.", wrap=500, bullet=True)
+add_text("Container commands (add_group, add_child, end_* and the like) can't be used from the asyncronous function."
+         " Pass parent to add widgets to an existing container instead.", wrap=500, bullet=True)
 add_text("If you need to return something from the asyncronous function, just return it like normal"
          " and use the 'return_handler' keyword. The return handler is another function that is called (on the main thread)"
          " when the asyncronous function is finished and the data argument is whatever the function "
@@ -24,12 +27,27 @@ add_spacing()
 
 add_button("Start Long Process", callback="long_callback")
 add_button("Start Long Asyncronous Process", callback="long_asyncronous_callback")
+add_button("Start Asyncronous Progress", callback="progress_asyncronous_callback")
+add_progress_bar("Progress", 0.0)
 
 
 def long_asyncronous_callback(sender, data):
     run_async_function("long_callback2", "some_data", return_handler="return_from_long_callback")
 
 
+def progress_asyncronous_callback(sender, data):
+    run_async_function("progress_callback", None)
+
+
+def progress_callback(sender, data):
+    # updates the widget directly from the worker thread
+    for step in range(1, 101):
+        for i in range(0, 500000):
+            pass
+        set_value("Progress", step/100)
+    add_text("Finished async progress", parent="MainWindow")
+
+
 def long_callback(sender, data):
     for i in range(0, 50000000):
         pass
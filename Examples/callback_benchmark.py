@@ -0,0 +1,67 @@
+from dearpygui.dearpygui import *
+from time import perf_counter
+import sys
+import types
+
+# Measures callbacks per second through run_async_function. Every call
+# runs the async function and then its return handler, so each completed
+# call is two callback dispatches. Callbacks are resolved once and cached,
+# so a callback living outside of __main__ (which used to require a scan
+# of every loaded module per call) should be as fast as one in __main__.
+
+calls = 5000
+
+# a function only defined in another module, found by name
+helper = types.ModuleType("callback_benchmark_helper")
+exec("def module_work(sender, data):\n    return data\n", helper.__dict__)
+sys.modules[helper.__name__] = helper
+
+# load some modules so a module scan has something to walk
+import json, csv, decimal, fractions, statistics, email, http.client, xml.dom.minidom
+
+# (description, async function name, return handler)
+modes = [
+    ("__main__ function by name", "work", "returned"),
+    ("module function by name", "module_work", "returned"),
+    ("return handler as callable", "work", None),
+]
+
+mode = 0
+completed = 0
+start = 0.0
+waiting = False
+
+
+def work(sender, data):
+    return data
+
+
+def returned(sender, data):
+    global completed, mode, waiting
+    completed += 1
+    if completed == calls:
+        elapsed = perf_counter() - start
+        log_info(modes[mode][0] + ": " + str(int(2*calls/elapsed)) + " callbacks/s")
+        mode += 1
+        waiting = False
+
+
+def render(sender, data):
+    global completed, start, waiting
+
+    if waiting or mode >= len(modes):
+        return
+
+    completed = 0
+    waiting = True
+    start = perf_counter()
+    description, function, handler = modes[mode]
+    for i in range(0, calls):
+        run_async_function(function, i, return_handler=handler if handler else returned)
+
+
+add_text("Callback throughput (see logger for results)")
+set_render_callback("render")
+show_logger()
+
+start_dearpygui()
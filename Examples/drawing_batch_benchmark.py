@@ -0,0 +1,73 @@
+from dearpygui.dearpygui import *
+from time import perf_counter
+import random
+import array
+
+# Builds scatters of dots one draw_circle call at a time and with a single
+# draw_circles call (packed arrays, numpy arrays work as well), and logs how
+# long each took to build and the average frame time once built. Small
+# batches are replayed from the drawing cache, batches over the cache's
+# index range (about 65k vertices) are drawn directly every frame.
+
+counts = [1000, 100000]
+sample_frames = 120
+width = 800
+height = 600
+
+add_text("Scatter benchmark (see logger for results)")
+add_drawing("canvas", width=width, height=height)
+show_logger()
+
+stages = [(count, batched) for count in counts for batched in (False, True)]
+stage = -1
+frame = 0
+total = 0.0
+
+
+def fill(count, batched):
+    clear_drawing("canvas")
+    random.seed(count)
+    centers = array.array("f", [random.uniform(0, width) if i % 2 == 0 else random.uniform(0, height) for i in range(0, count*2)])
+    colors = array.array("B", [random.randint(0, 255) if i % 4 != 3 else 255 for i in range(0, count*4)])
+
+    start = perf_counter()
+    if batched:
+        draw_circles("canvas", centers, [2], colors, segments=6, fills=colors)
+    else:
+        for i in range(0, count):
+            color = [colors[i*4], colors[i*4 + 1], colors[i*4 + 2], 255]
+            draw_circle("canvas", [centers[i*2], centers[i*2 + 1]], 2, color, segments=6, fill=color)
+    return perf_counter() - start
+
+
+def render(sender, data):
+    global stage, frame, total, build
+
+    if stage == len(stages):
+        return
+
+    if stage >= 0:
+        # skip the first frames (commands converted and cache built)
+        frame += 1
+        if frame > 10:
+            total += get_delta_time()
+
+        if frame < sample_frames + 10:
+            return
+
+        count, batched = stages[stage]
+        log_info(str(count) + (" dots, draw_circles: " if batched else " dots, draw_circle:  ")
+                 + str(round(build, 3)) + " s to build, "
+                 + str(round(1000.0*total/sample_frames, 3)) + " ms/frame")
+
+    stage += 1
+    frame = 0
+    total = 0.0
+    if stage < len(stages):
+        build = fill(*stages[stage])
+
+
+build = 0.0
+set_render_callback("render")
+
+start_dearpygui()
@@ -0,0 +1,69 @@
+from dearpygui.dearpygui import *
+import random
+
+# Measures the average frame time of a drawing for several primitive counts.
+# Static drawings are replayed from their cached vertex buffer, animated
+# drawings (one tagged line moves every frame) are drawn command by command.
+
+counts = [1000, 10000, 50000]
+sample_frames = 120
+width = 800
+height = 600
+
+add_text("Drawing frame times (see logger for results)")
+add_drawing("canvas", width=width, height=height)
+show_logger()
+
+stages = [(count, animated) for count in counts for animated in (False, True)]
+stage = -1
+frame = 0
+total = 0.0
+
+
+def fill(count):
+    clear_drawing("canvas")
+    random.seed(count)
+    for i in range(0, count):
+        x = random.uniform(0, width)
+        y = random.uniform(0, height)
+        color = [random.randint(0, 255), random.randint(0, 255), random.randint(0, 255), 255]
+        if i % 2 == 0:
+            draw_line("canvas", [x, y], [x + 20, y + 10], color, 1)
+        else:
+            draw_rectangle("canvas", [x, y], [x + 8, y + 8], color)
+    draw_line("canvas", [0, 0], [0, height], [255, 255, 255, 255], 2, tag="moving")
+
+
+def render(sender, data):
+    global stage, frame, total
+
+    if stage == len(stages):
+        return
+
+    if stage >= 0:
+        count, animated = stages[stage]
+        if animated:
+            x = frame % width
+            draw_line("canvas", [x, 0], [x, height], [255, 255, 255, 255], 2, tag="moving")
+
+        # skip the first frames (commands converted and cache built)
+        frame += 1
+        if frame > 10:
+            total += get_delta_time()
+
+        if frame < sample_frames + 10:
+            return
+
+        log_info(str(count) + " primitives, " + ("animated" if animated else "static") + ": "
+                 + str(round(1000.0*total/sample_frames, 3)) + " ms/frame")
+
+    stage += 1
+    frame = 0
+    total = 0.0
+    if stage < len(stages):
+        fill(stages[stage][0])
+
+
+set_render_callback("render")
+
+start_dearpygui()
@@ -0,0 +1,75 @@
+from dearpygui.dearpygui import *
+from time import perf_counter
+import os
+import tempfile
+
+# Loads 500 images at once. Images are decoded on worker threads and
+# uploaded a few per frame (see set_texture_upload_budget), so frames keep
+# rendering while placeholders are shown. Logs the time until the last
+# upload and the slowest frame seen while loading.
+
+image_count = 500
+image_size = 128
+
+# write uncompressed ppm images, each with its own color
+directory = tempfile.mkdtemp()
+files = []
+for i in range(0, image_count):
+    file = os.path.join(directory, "image" + str(i) + ".ppm")
+    with open(file, "wb") as f:
+        f.write(("P6 " + str(image_size) + " " + str(image_size) + " 255\n").encode())
+        f.write(bytes([i % 256, (i*7) % 256, (i*13) % 256])*(image_size*image_size))
+    files.append(file)
+
+add_text("Loading " + str(image_count) + " images (see logger for results)")
+add_child("images", height=0)
+for i in range(0, image_count):
+    add_image("image" + str(i), files[i], width=32, height=32)
+    if i % 20 != 19:
+        add_same_line()
+end_child()
+show_logger()
+
+# 4 images per frame
+set_texture_upload_budget(image_size*image_size*4*4)
+
+start = None
+slowest = 0.0
+frames = 0
+idle_frames = 0
+uploaded = False
+uploading = True
+
+
+def render(sender, data):
+    global start, slowest, frames, idle_frames, uploaded, uploading
+
+    if not uploading:
+        return
+
+    if start is None:
+        start = perf_counter()
+        return
+
+    frames += 1
+    slowest = max(slowest, get_delta_time())
+
+    # the zones are from the previous frame, decoding may briefly fall
+    # behind the uploads so wait for a few frames without any
+    if "texture uploads" in [zone[0] for zone in get_profile_zones()]:
+        uploaded = True
+        idle_frames = 0
+    elif uploaded:
+        idle_frames += 1
+
+    if idle_frames == 10:
+        uploading = False
+        frames -= idle_frames
+        log_info("loaded " + str(image_count) + " images in " + str(round(perf_counter() - start, 3)) + " s over "
+                 + str(frames) + " frames, slowest frame " + str(round(slowest*1000.0, 2)) + " ms")
+
+
+set_render_callback("render")
+set_profiling(True)
+
+start_dearpygui()
@@ -22,8 +22,19 @@ add_label_text("Right Mouse Down", "False", color=[0, 200, 255])
 add_label_text("Left Mouse Released", "False", color=[0, 200, 255])
 add_label_text("Middle Mouse Released", "False", color=[0, 200, 255])
 add_label_text("Right Mouse Released", "False", color=[0, 200, 255])
+add_spacing()
+add_text("Batched Input (one callback per frame with input)")
+add_label_text("Keys Down", "[]", color=[0, 200, 255])
+add_label_text("Mouse Down", "[]", color=[0, 200, 255])
 
 set_render_callback("main_callback", "MainWindow")
+set_input_callback("input_callback", "MainWindow")
+
+
+def input_callback(sender, data):
+
+    set_value("Keys Down", str([key for key, duration in data["keys_down"]]))
+    set_value("Mouse Down", str([button for button, duration in data["mouse_down"]]))
 
 
 def main_callback(sender, data):
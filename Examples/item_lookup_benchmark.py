@@ -0,0 +1,34 @@
+from dearpygui.dearpygui import *
+from time import perf_counter
+
+# Measures get_value/set_value cost as the number of widgets grows.
+# Item lookups go through the app's name registry so the time per
+# call should stay flat regardless of tree size.
+
+lookups = 10000
+total = 0
+
+add_text("Lookup cost vs. tree size (see logger for results)")
+
+for size in (100, 1000, 10000, 20000):
+
+    add_window("Benchmark " + str(size), hide=True)
+    for i in range(0, size):
+        add_input_int("bench_" + str(size) + "_" + str(i))
+    end_window()
+
+    # look up the most recently added item (worst case for a tree walk)
+    name = "bench_" + str(size) + "_" + str(size - 1)
+
+    start = perf_counter()
+    for i in range(0, lookups):
+        set_value(name, i)
+        get_value(name)
+    elapsed = perf_counter() - start
+
+    total += size
+    log_info("items: " + str(total) + " -> " + str(round(elapsed*1e6/lookups, 3)) + " us per get/set pair")
+
+show_logger()
+
+start_dearpygui()
@@ -0,0 +1,62 @@
+from dearpygui.dearpygui import *
+from array import array
+from math import sin
+
+# Measures the average frame time of a line series at 10k, 1M and 10M
+# points. Large series are drawn from a min/max level of detail pyramid
+# so the frame time should stay roughly flat as the point count grows.
+
+sizes = (10000, 1000000, 10000000)
+frames_per_size = 200
+
+add_data("size index", 0)
+add_data("frame", 0)
+add_data("elapsed", 0.0)
+
+add_text("Frame time vs. series size (see logger for results)")
+add_plot("Benchmark Plot", height=-1)
+
+
+def load_series(size):
+
+    xs = array('f', range(0, size))
+    ys = array('f', (sin(i*0.001) + (i % 7)*0.05 for i in range(0, size)))
+    clear_plot("Benchmark Plot")
+    add_line_series("Benchmark Plot", "Series", x=xs, y=ys)
+    set_plot_xlimits_auto("Benchmark Plot")
+    set_plot_ylimits_auto("Benchmark Plot")
+
+
+def render(sender, data):
+
+    index = get_data("size index")
+    if index >= len(sizes):
+        return
+
+    frame = get_data("frame")
+    elapsed = get_data("elapsed")
+
+    # skip the first frames after loading the series
+    if frame > 10:
+        elapsed += get_delta_time()
+
+    frame += 1
+
+    if frame == frames_per_size:
+        log_info("points: " + str(sizes[index]) + " -> " + str(round(elapsed*1000/(frames_per_size - 11), 3)) + " ms per frame")
+        index += 1
+        frame = 0
+        elapsed = 0.0
+        if index < len(sizes):
+            load_series(sizes[index])
+
+    add_data("size index", index)
+    add_data("frame", frame)
+    add_data("elapsed", elapsed)
+
+
+load_series(sizes[0])
+set_render_callback("render")
+show_logger()
+
+start_dearpygui()
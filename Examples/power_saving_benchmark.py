@@ -0,0 +1,35 @@
+from dearpygui.dearpygui import *
+from time import perf_counter, process_time, sleep
+import threading
+
+# Measures the process CPU usage of an idle app with power saving mode off
+# and on. In power saving mode the render loop sleeps until there is input
+# or a redraw is requested, so keep the mouse outside of the window while
+# this runs. Measurements are taken on a background thread since render
+# callbacks don't run while the app is idle.
+
+sample_time = 5.0
+
+add_text("Idle cpu usage with and without power saving (see logger for results)")
+add_input_text("Typing here keeps frames rendering (cursor blink)")
+show_logger()
+
+
+def measure():
+    sleep(2.0)
+    for enabled in (False, True):
+        set_power_saving_mode(enabled)
+        sleep(1.0)
+
+        start = perf_counter()
+        cpu = process_time()
+        sleep(sample_time)
+        usage = 100.0*(process_time() - cpu)/(perf_counter() - start)
+
+        log_info("power saving " + ("on" if enabled else "off") + ": " + str(round(usage, 1)) + "% cpu")
+        request_redraw()
+
+
+threading.Thread(target=measure, daemon=True).start()
+
+start_dearpygui()
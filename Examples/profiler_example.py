@@ -0,0 +1,34 @@
+from dearpygui.dearpygui import *
+
+# Records timing zones for every frame. Open the metrics window and expand
+# "Profiler" to see the timeline, or press the button to print the zones of
+# the last frame and write a trace for chrome://tracing.
+
+add_text("Move the slider to make the render callback slower")
+add_slider_int("Work", default_value=1000, min_value=0, max_value=200000)
+add_button("Log zones", callback="log_zones")
+add_button("Export trace", callback="export_trace")
+show_logger()
+show_metrics()
+
+
+def render(sender, data):
+    total = 0
+    for i in range(0, get_value("Work")):
+        total += i
+
+
+def log_zones(sender, data):
+    for name, start, duration, depth in get_profile_zones():
+        log_info("  "*depth + name + ": " + str(round(duration, 3)) + " ms")
+
+
+def export_trace(sender, data):
+    export_profile_trace("trace.json")
+    log_info("wrote trace.json")
+
+
+set_render_callback("render")
+set_profiling(True)
+
+start_dearpygui()
@@ -1,4 +1,5 @@
 from dearpygui.dearpygui import *
+from array import array
 
 # tables
 add_button("Delete row 6", callback="DeleteRow")
@@ -8,6 +9,8 @@ add_button("Add col ", callback="AddCol")
 add_button("Insert row 5", callback="InsertRow")
 add_button("Insert col 1 ", callback="InsertCol")
 add_button("Clear Table ", callback="ClearTable")
+add_button("Set 50k rows from columns", callback="SetColumns")
+add_button("Update rows 0-4", callback="SetRows")
 add_table("Table##widget", ["Column 1", "Column 2", "Column 3", "Column 4"])
 
 tabledata = []
@@ -24,6 +27,17 @@ def ClearTable(sender, data):
     clear_table("Table##widget")
 
 
+def SetColumns(sender, data):
+    ids = array('i', range(0, 50000))
+    values = array('d', (i*0.5 for i in range(0, 50000)))
+    names = ["name" + str(i) for i in range(0, 50000)]
+    set_table_data("Table##widget", [ids, values, names], headers=["ID", "Value", "Name"], formats=["%d", "%.2f"])
+
+
+def SetRows(sender, data):
+    set_table_rows("Table##widget", 0, [["updated" + str(i)]*4 for i in range(0, 5)])
+
+
 def DeleteRow(sender, data):
     delete_row("Table##widget", 6)
 
@@ -0,0 +1,81 @@
+from dearpygui.dearpygui import *
+from time import perf_counter, process_time
+
+# Measures the thread pool used by run_async_function. The process CPU
+# usage is sampled with no pool, then task dispatch latency (submit to
+# the async function starting) is measured one task at a time, then the
+# CPU usage is sampled again while the pool sits idle. Idle workers park
+# instead of spinning, so both samples should be about the same.
+
+sample_time = 3.0
+latency_calls = 200
+
+set_threadpool_timeout(60.0)
+
+phase = 0
+phase_start = 0.0
+phase_cpu = 0.0
+baseline = 0.0
+latencies = []
+waiting = False
+
+
+def cpu_usage():
+    return 100.0*(process_time() - phase_cpu)/(perf_counter() - phase_start)
+
+
+def start_phase(next_phase):
+    global phase, phase_start, phase_cpu
+    phase = next_phase
+    phase_start = perf_counter()
+    phase_cpu = process_time()
+
+
+def dispatch(sender, data):
+    latencies.append(perf_counter() - data)
+
+
+def dispatched(sender, data):
+    global waiting
+    waiting = False
+
+
+def render(sender, data):
+    global baseline, waiting
+
+    # cpu usage without a pool
+    if phase == 0:
+        if phase_start == 0.0:
+            start_phase(0)
+        elif perf_counter() - phase_start > sample_time:
+            baseline = cpu_usage()
+            log_info("cpu usage without pool: " + str(round(baseline, 1)) + "%")
+            start_phase(1)
+
+    # dispatch latency, one task in flight at a time so the workers park
+    # between tasks
+    elif phase == 1:
+        if waiting:
+            return
+        if len(latencies) == latency_calls:
+            ordered = sorted(latencies)
+            log_info("dispatch latency median: " + str(round(ordered[len(ordered)//2]*1000000, 1)) + " us")
+            log_info("dispatch latency p99: " + str(round(ordered[int(len(ordered)*0.99)]*1000000, 1)) + " us")
+            start_phase(2)
+            return
+        waiting = True
+        run_async_function("dispatch", perf_counter(), return_handler="dispatched")
+
+    # cpu usage with an idle pool
+    elif phase == 2:
+        if perf_counter() - phase_start > sample_time:
+            usage = cpu_usage()
+            log_info("cpu usage with idle pool: " + str(round(usage, 1)) + "% (" + str(round(usage - baseline, 1)) + "% above baseline)")
+            start_phase(3)
+
+
+add_text("Thread pool idle cpu usage and dispatch latency (see logger for results)")
+set_render_callback("render")
+show_logger()
+
+start_dearpygui()
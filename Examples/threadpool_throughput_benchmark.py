@@ -0,0 +1,85 @@
+from dearpygui.dearpygui import *
+from time import perf_counter
+from threading import Lock
+import hashlib
+
+# Measures async callback throughput of the thread pool with 1, 4 and 16
+# workers by fanning out many small run_async_function calls per frame.
+# Between runs the pool timeout is dropped to 0 so the pool is destroyed
+# and recreated with the next thread count.
+#
+# Each task hashes a buffer, hashlib releases the GIL for inputs over 2 KB
+# so workers can overlap. Pure python work would only measure contention
+# on the GIL. The python call into each task still takes the GIL.
+
+worker_counts = (1, 4, 16)
+calls_per_frame = 500
+frames_per_run = 100
+payload = bytes(64 * 1024)
+
+run = 0
+frame = 0
+submitted = 0
+completed = 0
+completed_lock = Lock()
+start = 0.0
+retiring = 0
+
+
+def work(sender, data):
+    global completed
+    hashlib.sha256(payload).digest()
+
+    # workers finish concurrently, unguarded increments can be lost
+    with completed_lock:
+        completed += 1
+
+
+def render(sender, data):
+    global run, frame, submitted, completed, start, retiring
+
+    if run >= len(worker_counts):
+        return
+
+    # give the old pool a couple of frames to be destroyed
+    if retiring > 0:
+        retiring -= 1
+        if retiring == 0:
+            set_threadpool_timeout(60.0)
+            set_thread_count(worker_counts[run])
+        return
+
+    if frame == 0:
+        with completed_lock:
+            completed = 0
+        submitted = 0
+        start = perf_counter()
+
+    if frame < frames_per_run:
+        for i in range(0, calls_per_frame):
+            run_async_function("work", i)
+        submitted += calls_per_frame
+        frame += 1
+        return
+
+    # wait for the queues to drain
+    if completed < submitted:
+        return
+
+    elapsed = perf_counter() - start
+    log_info(str(worker_counts[run]) + " workers: " + str(int(completed/elapsed)) + " callbacks/s")
+
+    run += 1
+    frame = 0
+    retiring = 3
+    set_threadpool_timeout(0.0)
+
+
+set_threadpool_timeout(60.0)
+set_thread_count(worker_counts[0])
+
+add_text("Thread pool throughput at 1, 4 and 16 workers (see logger for results)")
+set_render_callback("render")
+show_logger()
+
+start_dearpygui()